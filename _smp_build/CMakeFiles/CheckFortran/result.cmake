@@ -0,0 +1,2 @@
+set(CMAKE_Fortran_COMPILER "/usr/bin/f95")
+
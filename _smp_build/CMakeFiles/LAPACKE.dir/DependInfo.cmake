@@ -0,0 +1,2574 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cbbcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cbbcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cbdsqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cbdsqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbbrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbbrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgebrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgecon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgecon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgees.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgees_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgehrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgehrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgejsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgejsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelq2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelq2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgels.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgels_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelss.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelss_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgelsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgemqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqlf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqlf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqpf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqpf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqr2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqr2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgeqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgerfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgerfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgerqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgerqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesdd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesdd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvj.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvj_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetsls.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetsls_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggbak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggbak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggbal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggbal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgges.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgges3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgges3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgges_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggev3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggev3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggglm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggglm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgghd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgghd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgghrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgghrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgglse.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgglse_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggrqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggrqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cggsvp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgtsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cgttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbtrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chbtrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_checon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_checon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_checon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_checon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chegvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cherfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cherfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cheswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chfrk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chfrk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chgeqz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chgeqz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chpsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chsein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chsein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chseqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_chseqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacn2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacn2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacp2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacp2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacpy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacpy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacrm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clacrm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clag2z.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clag2z_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clagge.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clagge_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claghe.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claghe_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clagsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clagsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clange.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clange_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clanhe.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clanhe_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clansy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clansy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clantr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clantr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clapmr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clapmr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clapmt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clapmt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarcm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarcm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfg.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfg_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarft.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarft_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarfx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarnv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clarnv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clascl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clascl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claset.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claset_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_classq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_classq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claswp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_claswp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clatms.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clatms_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clauum.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_clauum_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbstf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbstf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpftrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpocon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpocon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpoequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpoequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpoequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpoequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cporfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cporfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cposvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cposvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpotrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cppsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpstrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpstrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cptsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cpttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cspsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstedc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstedc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstegr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstegr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstemr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cstemr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csycon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csycon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csycon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csycon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyconv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyconv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csysvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csyswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_csytrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfsm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfsm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctfttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsja.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsja_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctgsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctprfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctprfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctpttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrtri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrtri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctrttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctzrzf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ctzrzf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunbdb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunbdb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cuncsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cuncsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunghr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunghr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunglq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunglq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmhr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmhr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmrz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmrz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cunmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cupgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cupgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cupmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_cupmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbbcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbbcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsdc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsdc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ddisna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ddisna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbbrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbbrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgebrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgecon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgecon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgees.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgees_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgehrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgehrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgejsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgejsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelq2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelq2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgels.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgels_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelss.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelss_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgelsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgemqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqlf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqlf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqpf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqpf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqr2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqr2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgeqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgerfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgerfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgerqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgerqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesdd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesdd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvdq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvdq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvj.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvj_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetsls.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetsls_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggbak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggbak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggbal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggbal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgges.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgges3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgges3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgges_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggev3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggev3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggglm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggglm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgghd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgghd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgghrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgghrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgglse.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgglse_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggrqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggrqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dggsvp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgtsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dgttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhgeqz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhgeqz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhsein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhsein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhseqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dhseqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlacn2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlacn2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlacpy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlacpy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlag2s.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlag2s_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlagge.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlagge_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlagsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlagsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlamch.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlamch_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlange.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlange_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlansy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlansy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlantr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlantr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapmr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapmr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapmt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapmt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapy2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapy2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapy3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlapy3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfg.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfg_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarft.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarft_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarfx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarnv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlarnv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlartgp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlartgp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlartgs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlartgs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlascl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlascl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlaset.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlaset_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlasrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlasrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlassq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlassq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlaswp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlaswp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlatms.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlatms_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlauum.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dlauum_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dopgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dopgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dopmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dopmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorbdb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorbdb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorghr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorghr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorglq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorglq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormhr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormhr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormrz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormrz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dormtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbstf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbstf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpftrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpocon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpocon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpoequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpoequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpoequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpoequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dporfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dporfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dposvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dposvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpotrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dppsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpstrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpstrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dptsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dpttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbtrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsbtrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsfrk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsfrk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dspsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstebz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstebz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstedc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstedc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstegr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstegr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstemr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstemr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsterf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsterf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dstevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsycon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsycon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsycon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsycon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyconv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyconv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsygvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsysvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsyswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dsytrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfsm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfsm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtfttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsja.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsja_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtgsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtprfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtprfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtpttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrtri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrtri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtrttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtzrzf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_dtzrzf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ilaver.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ilaver.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ilaver.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbbcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbbcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsdc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsdc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sdisna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sdisna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbbrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbbrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgebrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgecon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgecon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgees.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgees_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgehrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgehrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgejsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgejsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelq2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelq2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgels.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgels_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelss.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelss_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgelsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgemqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqlf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqlf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqpf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqpf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqr2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqr2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgeqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgerfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgerfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgerqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgerqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesdd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesdd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvdq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvdq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvj.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvj_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetsls.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetsls_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggbak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggbak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggbal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggbal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgges.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgges3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgges3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgges_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggev3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggev3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggglm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggglm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgghd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgghd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgghrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgghrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgglse.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgglse_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggrqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggrqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sggsvp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgtsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sgttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shgeqz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shgeqz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shsein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shsein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shseqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_shseqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slacn2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slacn2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slacpy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slacpy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slag2d.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slag2d_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slagge.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slagge_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slagsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slagsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slamch.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slamch_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slange.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slange_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slansy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slansy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slantr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slantr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapmr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapmr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapmt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapmt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapy2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapy2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapy3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slapy3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfg.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfg_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarft.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarft_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarfx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarnv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slarnv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slartgp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slartgp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slartgs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slartgs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slascl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slascl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slaset.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slaset_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slasrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slasrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slassq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slassq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slaswp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slaswp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slatms.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slatms_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slauum.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_slauum_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sopgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sopgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sopmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sopmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorbdb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorbdb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorghr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorghr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorglq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorglq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormhr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormhr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormrz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormrz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sormtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbstf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbstf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spftrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spocon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spocon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spoequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spoequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spoequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spoequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sporfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sporfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sposvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sposvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spotrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sppsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spstrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spstrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sptsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_spttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbtrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssbtrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssfrk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssfrk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sspsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstebz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstebz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstedc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstedc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstegr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstegr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstemr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstemr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssterf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssterf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_sstevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssycon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssycon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssycon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssycon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyconv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyconv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssygvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssysvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssyswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ssytrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfsm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfsm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stfttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsja.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsja_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stgsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpmqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpmqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stprfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stprfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stpttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strtri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strtri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_strttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stzrzf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_stzrzf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zbbcsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zbbcsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zbdsqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zbdsqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zcgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zcgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zcposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zcposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbbrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbbrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgebrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgecon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgecon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgees.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgees_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgehrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgehrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgejsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgejsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelq2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelq2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgels.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgels_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelss.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelss_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgelsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgemqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqlf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqlf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqpf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqpf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqr2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqr2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgeqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgerfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgerfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgerqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgerqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesdd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesdd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvdq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvdq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvdx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvdx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvj.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvj_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetsls.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetsls_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggbak.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggbak_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggbal.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggbal_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgges.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgges3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgges3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgges_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggesx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggesx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggev3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggev3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggglm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggglm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgghd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgghd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgghrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgghrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgglse.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgglse_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggqrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggqrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggrqf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggrqf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvd3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvd3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvp3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvp3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zggsvp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgtsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zgttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbtrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhbtrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhecon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhecon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhecon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhecon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhegvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zherfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zherfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhesvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zheswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhetrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhfrk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhfrk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhgeqz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhgeqz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpev.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpev_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpevd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpevd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpevx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpevx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgst.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgst_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgvd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgvd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpgvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhpsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhsein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhsein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhseqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zhseqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacgv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacgv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacn2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacn2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacp2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacp2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacpy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacpy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacrm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlacrm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlag2c.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlag2c_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlagge.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlagge_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaghe.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaghe_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlagsy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlagsy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlange.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlange_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlanhe.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlanhe_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlansy.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlansy_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlantr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlantr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlapmr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlapmr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlapmt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlapmt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarcm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarcm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfg.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfg_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarft.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarft_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarfx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarnv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlarnv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlascl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlascl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaset.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaset_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlassq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlassq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaswp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlaswp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlatms.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlatms_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlauum.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zlauum_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbstf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbstf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbtrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbtrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpftrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpocon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpocon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpoequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpoequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpoequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpoequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zporfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zporfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zposv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zposv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zposvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zposvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrf2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrf2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpotrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppequ.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppequ_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zppsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpstrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpstrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zptsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpttrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpttrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpttrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zpttrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspsv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspsv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspsvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zspsvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstedc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstedc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstegr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstegr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstein.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstein_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstemr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zstemr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsteqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsteqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsycon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsycon_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsycon_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsycon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyconv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyconv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyequb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyequb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysv_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysvx.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsysvx_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyswapr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsyswapr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri2x.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri2x_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zsytrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztbtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfsm.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfsm_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztftri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztftri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztfttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsja.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsja_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztgsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpqrt.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpqrt_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztprfb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztprfb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztprfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztprfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztptri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztptri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztptrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztptrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpttr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztpttr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrcon.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrcon_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrevc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrevc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrexc.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrexc_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrrfs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrrfs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsen.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsen_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsna.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsna_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsyl.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrsyl_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrtri.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrtri_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrtrs.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrtrs_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrttf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrttf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrttp.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztrttp_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztzrzf.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_ztzrzf_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunbdb.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunbdb_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zuncsd.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zuncsd_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunghr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunghr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunglq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunglq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmbr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmbr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmhr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmhr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmlq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmlq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmql.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmql_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmqr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmqr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmrq.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmrq_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmrz.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmrz_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zunmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zupgtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zupgtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zupmtr.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/src/lapacke_zupmtr_work.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr_work.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr_work.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_c_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_c_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_c_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cgb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cgb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cge_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cge_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cgg_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cgg_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cgt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_che_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_che_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chs_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_chs_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpo_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpo_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cpt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_csp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_csp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_cst_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cst_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cst_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_csy_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_csy_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctr_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ctr_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_d_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_d_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_d_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dgb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dgb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dge_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dge_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dgg_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dgg_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dgt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dhs_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dhs_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpo_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpo_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dpt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dst_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dst_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dst_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsy_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dsy_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtr_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_dtr_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_lsame.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_lsame.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_lsame.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_make_complex_double.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_double.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_double.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_make_complex_float.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_float.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_float.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_s_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_s_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_s_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sgb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sgb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sge_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sge_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sgg_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sgg_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sgt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_shs_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_shs_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spo_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spo_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_spt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_sst_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sst_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sst_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssy_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ssy_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_stp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_str_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_str_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_xerbla.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_xerbla.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_xerbla.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_z_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_z_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_z_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zgb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zgb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zge_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zge_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zgg_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zgg_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zgt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhe_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhe_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhs_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zhs_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpo_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpo_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zpt_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpt_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpt_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zsp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zsp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zst_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zst_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zst_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zsy_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_zsy_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztb_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztb_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztf_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztf_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztp_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztp_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_trans.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztr_nancheck.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_nancheck.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_nancheck.c.o.d"
+  "/root/repo/lapack-netlib/LAPACKE/utils/lapacke_ztr_trans.c" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_trans.c.o" "gcc" "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_trans.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
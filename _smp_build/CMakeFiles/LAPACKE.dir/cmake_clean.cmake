@@ -0,0 +1,5119 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbbcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cbdsqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbbrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgebrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgecon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgees_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgehrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgejsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgels_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelss_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgelsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgemqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqlf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqpf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrfp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgeqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgerqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesdd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvj_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsls_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgetsqrhrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggbal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgges_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggglm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgghrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgglse_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggrqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cggsvp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgtsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cgttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chbtrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_checon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chegvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cherfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cheswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chfrk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chgeqz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chpsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chsein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_chseqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacn2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacp2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacpy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clacrm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clag2z_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagge_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claghe_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clagsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clange_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clanhe_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clansy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clantr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clapmt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarcm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfg_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarft_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarfx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clarnv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clascl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claset_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_classq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_claswp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clatms_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_clauum_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbstf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpftrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpocon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpoequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cporfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cposvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpotrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cppsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpstrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cptsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cpttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cspsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstedc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstegr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cstemr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csycon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyconv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csysvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csyswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_csytrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfsm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctfttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsja_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctgsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpmqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctpttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctrttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ctzrzf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunbdb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd2by1_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cuncsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunghr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunglq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cungtsqr_row_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmhr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmrz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cunmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_cupmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbbcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsdc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dbdsvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ddisna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbbrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgebrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgecon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgees_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgehrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgejsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgels_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelss_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgelsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgemqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqlf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqpf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrfp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgeqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgerqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesdd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvj_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsls_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgetsqrhrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggbal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgges_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggglm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgghrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgglse_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggrqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dggsvp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgtsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dgttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhgeqz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhsein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dhseqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacn2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlacpy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlag2s_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagge_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlagsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlamch_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlange_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlansy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlantr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapmt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlapy3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfg_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarft_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarfx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlarnv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlartgs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlascl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaset_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlasrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlassq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlaswp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlatms_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dlauum_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dopmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorbdb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd2by1_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorghr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorglq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dorgtsqr_row_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormhr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormrz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dormtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbstf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpftrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpocon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpoequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dporfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dposvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpotrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dppsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpstrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dptsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dpttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsbtrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsfrk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dspsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstebz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstedc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstegr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstemr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsterf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dstevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsycon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyconv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsygvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsysvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsyswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dsytrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfsm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtfttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsja_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtgsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpmqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtpttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtrttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_dtzrzf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ilaver.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ilaver.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbbcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsdc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sbdsvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sdisna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbbrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgebrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgecon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgees_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgehrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgejsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgels_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelss_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgelsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgemqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqlf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqpf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrfp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgeqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgerqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesdd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvj_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsls_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgetsqrhrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggbal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgges_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggglm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgghrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgglse_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggrqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sggsvp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgtsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sgttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shgeqz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shsein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_shseqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacn2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slacpy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slag2d_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagge_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slagsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slamch_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slange_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slansy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slantr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapmt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slapy3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfg_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarft_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarfx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slarnv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slartgs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slascl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaset_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slasrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slassq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slaswp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slatms_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_slauum_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sopmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorbdb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd2by1_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorghr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorglq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sorgtsqr_row_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormhr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormrz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sormtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbstf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spftrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spocon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spoequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sporfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sposvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spotrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sppsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spstrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sptsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_spttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssbtrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssfrk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sspsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstebz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstedc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstegr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstemr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssterf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_sstevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssycon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyconv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssygvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssysvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssyswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ssytrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfsm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stfttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsja_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stgsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpmqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stpttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_strttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_stzrzf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbbcsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zbdsqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zcposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbbrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgebrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgecon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgees_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgehrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgejsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgels_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelss_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgelsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgemqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqlf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqpf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrfp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgeqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgerqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesdd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvdx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvj_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsls_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgetsqrhrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbak_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggbal_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgges_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggesx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggglm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgghrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgglse_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggqrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggrqf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zggsvp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgtsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zgttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhbtrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhecon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhegvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zherfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhesvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zheswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhetrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhfrk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhgeqz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpev_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpevx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgst_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpgvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhpsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhsein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zhseqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacgv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacn2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacp2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacpy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlacrm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlag2c_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagge_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaghe_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlagsy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlange_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlanhe_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlansy_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlantr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlapmt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarcm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfg_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarft_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarfx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlarnv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlascl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaset_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlassq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlaswp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlatms_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zlauum_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbstf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpftrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpocon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpoequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zporfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zposvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpotrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppequ_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zppsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpstrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zptsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zpttrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zspsvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstedc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstegr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstein_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zstemr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsteqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsycon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyconv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyequb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysv_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsysvx_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsyswapr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rk_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri2x_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_3_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_2stage_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_aa_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_rook_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zsytrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztbtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfsm_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztftri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztfttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsja_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztgsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpmqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt2_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpqrt_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztprfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztptrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztpttr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrcon_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrevc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrexc_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrrfs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsen_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsna_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrsyl_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtri_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrtrs_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztrttp_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_ztzrzf_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunbdb_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd2by1_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zuncsd_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunghr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunglq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zungtsqr_row_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmbr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmhr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmlq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmql_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmqr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrq_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmrz_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zunmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupgtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr_work.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/src/lapacke_zupmtr_work.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_c_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_c_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cge_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgg_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cgt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_che_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_chs_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpo_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cpt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cst_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_cst_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_csy_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ctr_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_d_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_d_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dge_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgg_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dgt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dhs_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpo_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dpt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dst_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dst_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dsy_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_dtr_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_lsame.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_lsame.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_double.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_double.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_float.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_make_complex_float.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_s_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_s_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sge_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgg_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sgt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_shs_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spo_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_spt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sst_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_sst_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ssy_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_stp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_str_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_xerbla.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_xerbla.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_z_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_z_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zge_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgg_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zgt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhe_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zhs_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpo_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpt_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zpt_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zst_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zst_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_zsy_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztb_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztf_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztp_trans.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_nancheck.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_nancheck.c.o.d"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_trans.c.o"
+  "CMakeFiles/LAPACKE.dir/lapack-netlib/LAPACKE/utils/lapacke_ztr_trans.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/LAPACKE.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
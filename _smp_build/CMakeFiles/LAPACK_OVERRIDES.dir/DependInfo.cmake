@@ -0,0 +1,1957 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/root/repo/lapack-netlib/INSTALL/dlamch.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/dlamch.f.o"
+  "/root/repo/lapack-netlib/INSTALL/dsecnd_NONE.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/dsecnd_NONE.f.o"
+  "/root/repo/lapack-netlib/INSTALL/ilaver.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/ilaver.f.o"
+  "/root/repo/lapack-netlib/INSTALL/second_NONE.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/second_NONE.f.o"
+  "/root/repo/lapack-netlib/INSTALL/slamch.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/slamch.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cgegs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgegs.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cgegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgegv.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cgelsx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgelsx.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cgeqpf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgeqpf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cggsvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cggsvd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/cggsvp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cggsvp.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/clahrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/clahrd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/clatzm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/clatzm.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/ctzrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/ctzrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dgegs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgegs.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dgegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgegv.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dgelsx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgelsx.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dgeqpf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgeqpf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dggsvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dggsvd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dggsvp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dggsvp.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dlahrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dlahrd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dlatzm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dlatzm.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/dtzrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dtzrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sgegs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgegs.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sgegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgegv.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sgelsx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgelsx.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sgeqpf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgeqpf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sggsvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sggsvd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/sggsvp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sggsvp.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/slahrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/slahrd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/slatzm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/slatzm.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/stzrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/stzrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zgegs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgegs.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zgegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgegv.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zgelsx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgelsx.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zgeqpf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgeqpf.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zggsvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zggsvd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zggsvp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zggsvp.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zlahrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zlahrd.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/zlatzm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zlatzm.f.o"
+  "/root/repo/lapack-netlib/SRC/DEPRECATED/ztzrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/ztzrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/cbbcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cbbcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/cbdsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cbdsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbbrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbbrd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbequb.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cgebak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebak.f.o"
+  "/root/repo/lapack-netlib/SRC/cgebal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebal.f.o"
+  "/root/repo/lapack-netlib/SRC/cgebd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebd2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgebrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebrd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgecon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgecon.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeequ.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeequb.f.o"
+  "/root/repo/lapack-netlib/SRC/cgees.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgees.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeesx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeev.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeevx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgehd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgehd2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgehrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgehrd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgejsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgejsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelq.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelq2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqt.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelqt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqt3.f.o"
+  "/root/repo/lapack-netlib/SRC/cgels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgels.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelsd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelss.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelss.f.o"
+  "/root/repo/lapack-netlib/SRC/cgelsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelsy.f.o"
+  "/root/repo/lapack-netlib/SRC/cgemlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemlq.f.o"
+  "/root/repo/lapack-netlib/SRC/cgemlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/cgemqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cgemqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeql2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeql2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqlf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqlf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqp3.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqr2p.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr2p.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqrfp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrfp.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgeqrt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt3.f.o"
+  "/root/repo/lapack-netlib/SRC/cgerfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cgerq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerq2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgerqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerqf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesc2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesdd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesdd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesvdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvdq.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesvj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvj.f.o"
+  "/root/repo/lapack-netlib/SRC/cgesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgetc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetc2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgetrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/cgetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetri.f.o"
+  "/root/repo/lapack-netlib/SRC/cgetsls.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetsls.f.o"
+  "/root/repo/lapack-netlib/SRC/cgetsqrhrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetsqrhrt.f.o"
+  "/root/repo/lapack-netlib/SRC/cggbak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggbak.f.o"
+  "/root/repo/lapack-netlib/SRC/cggbal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggbal.f.o"
+  "/root/repo/lapack-netlib/SRC/cgges.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgges.f.o"
+  "/root/repo/lapack-netlib/SRC/cgges3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgges3.f.o"
+  "/root/repo/lapack-netlib/SRC/cggesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggesx.f.o"
+  "/root/repo/lapack-netlib/SRC/cggev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggev.f.o"
+  "/root/repo/lapack-netlib/SRC/cggev3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggev3.f.o"
+  "/root/repo/lapack-netlib/SRC/cggevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggevx.f.o"
+  "/root/repo/lapack-netlib/SRC/cggglm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggglm.f.o"
+  "/root/repo/lapack-netlib/SRC/cgghd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgghd3.f.o"
+  "/root/repo/lapack-netlib/SRC/cgghrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgghrd.f.o"
+  "/root/repo/lapack-netlib/SRC/cgglse.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgglse.f.o"
+  "/root/repo/lapack-netlib/SRC/cggqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cggrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/cggsvd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggsvd3.f.o"
+  "/root/repo/lapack-netlib/SRC/cggsvp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggsvp3.f.o"
+  "/root/repo/lapack-netlib/SRC/cgsvj0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgsvj0.f.o"
+  "/root/repo/lapack-netlib/SRC/cgsvj1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgsvj1.f.o"
+  "/root/repo/lapack-netlib/SRC/cgtcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtcon.f.o"
+  "/root/repo/lapack-netlib/SRC/cgtrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cgtsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cgtsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cgttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cgttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cgtts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtts2.f.o"
+  "/root/repo/lapack-netlib/SRC/chb2st_kernels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chb2st_kernels.f.o"
+  "/root/repo/lapack-netlib/SRC/chbev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbev.f.o"
+  "/root/repo/lapack-netlib/SRC/chbev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chbevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevd.f.o"
+  "/root/repo/lapack-netlib/SRC/chbevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chbevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevx.f.o"
+  "/root/repo/lapack-netlib/SRC/chbevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chbgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgst.f.o"
+  "/root/repo/lapack-netlib/SRC/chbgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgv.f.o"
+  "/root/repo/lapack-netlib/SRC/chbgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/chbgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/chbtrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbtrd.f.o"
+  "/root/repo/lapack-netlib/SRC/checon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon.f.o"
+  "/root/repo/lapack-netlib/SRC/checon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/checon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/cheequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheequb.f.o"
+  "/root/repo/lapack-netlib/SRC/cheev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheev.f.o"
+  "/root/repo/lapack-netlib/SRC/cheev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevd.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevr.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevr_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevr_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevx.f.o"
+  "/root/repo/lapack-netlib/SRC/cheevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chegs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegs2.f.o"
+  "/root/repo/lapack-netlib/SRC/chegst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegst.f.o"
+  "/root/repo/lapack-netlib/SRC/chegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegv.f.o"
+  "/root/repo/lapack-netlib/SRC/chegv_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegv_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chegvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegvd.f.o"
+  "/root/repo/lapack-netlib/SRC/chegvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cherfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cherfs.f.o"
+  "/root/repo/lapack-netlib/SRC/chesv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv.f.o"
+  "/root/repo/lapack-netlib/SRC/chesv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/chesv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chesv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/chesv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/chesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cheswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/chetd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetd2.f.o"
+  "/root/repo/lapack-netlib/SRC/chetf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2.f.o"
+  "/root/repo/lapack-netlib/SRC/chetf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/chetf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrd_hb2st.F" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_hb2st.F.o"
+  "/root/repo/lapack-netlib/SRC/chetrd_he2hb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_he2hb.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri2.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/chetri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/chetrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/chfrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chfrk.f.o"
+  "/root/repo/lapack-netlib/SRC/chgeqz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chgeqz.f.o"
+  "/root/repo/lapack-netlib/SRC/chla_transtype.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chla_transtype.f.o"
+  "/root/repo/lapack-netlib/SRC/chpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/chpev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpev.f.o"
+  "/root/repo/lapack-netlib/SRC/chpevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpevd.f.o"
+  "/root/repo/lapack-netlib/SRC/chpevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpevx.f.o"
+  "/root/repo/lapack-netlib/SRC/chpgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgst.f.o"
+  "/root/repo/lapack-netlib/SRC/chpgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgv.f.o"
+  "/root/repo/lapack-netlib/SRC/chpgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/chpgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/chprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/chpsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpsv.f.o"
+  "/root/repo/lapack-netlib/SRC/chpsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/chptrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrd.f.o"
+  "/root/repo/lapack-netlib/SRC/chptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/chptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptri.f.o"
+  "/root/repo/lapack-netlib/SRC/chptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/chsein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chsein.f.o"
+  "/root/repo/lapack-netlib/SRC/chseqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chseqr.f.o"
+  "/root/repo/lapack-netlib/SRC/clabrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clabrd.f.o"
+  "/root/repo/lapack-netlib/SRC/clacgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacgv.f.o"
+  "/root/repo/lapack-netlib/SRC/clacn2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacn2.f.o"
+  "/root/repo/lapack-netlib/SRC/clacon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacon.f.o"
+  "/root/repo/lapack-netlib/SRC/clacp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacp2.f.o"
+  "/root/repo/lapack-netlib/SRC/clacpy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacpy.f.o"
+  "/root/repo/lapack-netlib/SRC/clacrm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacrm.f.o"
+  "/root/repo/lapack-netlib/SRC/clacrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacrt.f.o"
+  "/root/repo/lapack-netlib/SRC/cladiv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cladiv.f.o"
+  "/root/repo/lapack-netlib/SRC/claed0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed0.f.o"
+  "/root/repo/lapack-netlib/SRC/claed7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed7.f.o"
+  "/root/repo/lapack-netlib/SRC/claed8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed8.f.o"
+  "/root/repo/lapack-netlib/SRC/claein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claein.f.o"
+  "/root/repo/lapack-netlib/SRC/claesy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claesy.f.o"
+  "/root/repo/lapack-netlib/SRC/claev2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claev2.f.o"
+  "/root/repo/lapack-netlib/SRC/clag2z.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clag2z.f.o"
+  "/root/repo/lapack-netlib/SRC/clags2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clags2.f.o"
+  "/root/repo/lapack-netlib/SRC/clagtm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clagtm.f.o"
+  "/root/repo/lapack-netlib/SRC/clahef.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef.f.o"
+  "/root/repo/lapack-netlib/SRC/clahef_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/clahef_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/clahef_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/clahqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahqr.f.o"
+  "/root/repo/lapack-netlib/SRC/clahr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahr2.f.o"
+  "/root/repo/lapack-netlib/SRC/claic1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claic1.f.o"
+  "/root/repo/lapack-netlib/SRC/clals0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clals0.f.o"
+  "/root/repo/lapack-netlib/SRC/clalsa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clalsa.f.o"
+  "/root/repo/lapack-netlib/SRC/clalsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clalsd.f.o"
+  "/root/repo/lapack-netlib/SRC/clamswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clamswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/clamtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clamtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/clangb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clangb.f.o"
+  "/root/repo/lapack-netlib/SRC/clange.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clange.f.o"
+  "/root/repo/lapack-netlib/SRC/clangt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clangt.f.o"
+  "/root/repo/lapack-netlib/SRC/clanhb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhb.f.o"
+  "/root/repo/lapack-netlib/SRC/clanhe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhe.f.o"
+  "/root/repo/lapack-netlib/SRC/clanhf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhf.f.o"
+  "/root/repo/lapack-netlib/SRC/clanhp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhp.f.o"
+  "/root/repo/lapack-netlib/SRC/clanhs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhs.f.o"
+  "/root/repo/lapack-netlib/SRC/clanht.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanht.f.o"
+  "/root/repo/lapack-netlib/SRC/clansb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansb.f.o"
+  "/root/repo/lapack-netlib/SRC/clansp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansp.f.o"
+  "/root/repo/lapack-netlib/SRC/clansy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansy.f.o"
+  "/root/repo/lapack-netlib/SRC/clantb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantb.f.o"
+  "/root/repo/lapack-netlib/SRC/clantp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantp.f.o"
+  "/root/repo/lapack-netlib/SRC/clantr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantr.f.o"
+  "/root/repo/lapack-netlib/SRC/clapll.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapll.f.o"
+  "/root/repo/lapack-netlib/SRC/clapmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapmr.f.o"
+  "/root/repo/lapack-netlib/SRC/clapmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapmt.f.o"
+  "/root/repo/lapack-netlib/SRC/claqgb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqgb.f.o"
+  "/root/repo/lapack-netlib/SRC/claqge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqge.f.o"
+  "/root/repo/lapack-netlib/SRC/claqhb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhb.f.o"
+  "/root/repo/lapack-netlib/SRC/claqhe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhe.f.o"
+  "/root/repo/lapack-netlib/SRC/claqhp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhp.f.o"
+  "/root/repo/lapack-netlib/SRC/claqp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqp2.f.o"
+  "/root/repo/lapack-netlib/SRC/claqps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqps.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr0.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr1.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr3.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr4.f.o"
+  "/root/repo/lapack-netlib/SRC/claqr5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr5.f.o"
+  "/root/repo/lapack-netlib/SRC/claqsb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsb.f.o"
+  "/root/repo/lapack-netlib/SRC/claqsp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsp.f.o"
+  "/root/repo/lapack-netlib/SRC/claqsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsy.f.o"
+  "/root/repo/lapack-netlib/SRC/clar1v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clar1v.f.o"
+  "/root/repo/lapack-netlib/SRC/clar2v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clar2v.f.o"
+  "/root/repo/lapack-netlib/SRC/clarcm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarcm.f.o"
+  "/root/repo/lapack-netlib/SRC/clarf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarf.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfb.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfb_gett.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfb_gett.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfg.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfgp.f.o"
+  "/root/repo/lapack-netlib/SRC/clarft.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarft.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfx.f.o"
+  "/root/repo/lapack-netlib/SRC/clarfy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfy.f.o"
+  "/root/repo/lapack-netlib/SRC/clargv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clargv.f.o"
+  "/root/repo/lapack-netlib/SRC/clarnv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarnv.f.o"
+  "/root/repo/lapack-netlib/SRC/clarrv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarrv.f.o"
+  "/root/repo/lapack-netlib/SRC/clartg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clartg.f.o"
+  "/root/repo/lapack-netlib/SRC/clartv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clartv.f.o"
+  "/root/repo/lapack-netlib/SRC/clarz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarz.f.o"
+  "/root/repo/lapack-netlib/SRC/clarzb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarzb.f.o"
+  "/root/repo/lapack-netlib/SRC/clarzt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarzt.f.o"
+  "/root/repo/lapack-netlib/SRC/clascl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clascl.f.o"
+  "/root/repo/lapack-netlib/SRC/claset.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claset.f.o"
+  "/root/repo/lapack-netlib/SRC/clasr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasr.f.o"
+  "/root/repo/lapack-netlib/SRC/classq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/classq.f.o"
+  "/root/repo/lapack-netlib/SRC/claswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/clasyf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf.f.o"
+  "/root/repo/lapack-netlib/SRC/clasyf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/clasyf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/clasyf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/clatbs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatbs.f.o"
+  "/root/repo/lapack-netlib/SRC/clatdf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatdf.f.o"
+  "/root/repo/lapack-netlib/SRC/clatps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatps.f.o"
+  "/root/repo/lapack-netlib/SRC/clatrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrd.f.o"
+  "/root/repo/lapack-netlib/SRC/clatrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrs.f.o"
+  "/root/repo/lapack-netlib/SRC/clatrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrz.f.o"
+  "/root/repo/lapack-netlib/SRC/clatsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/claunhr_col_getrfnp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claunhr_col_getrfnp.f.o"
+  "/root/repo/lapack-netlib/SRC/claunhr_col_getrfnp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claunhr_col_getrfnp2.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbstf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbstf.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cpbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cpftrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cpftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftri.f.o"
+  "/root/repo/lapack-netlib/SRC/cpftrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cpocon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpocon.f.o"
+  "/root/repo/lapack-netlib/SRC/cpoequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpoequ.f.o"
+  "/root/repo/lapack-netlib/SRC/cpoequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpoequb.f.o"
+  "/root/repo/lapack-netlib/SRC/cporfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cporfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cposv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cposv.f.o"
+  "/root/repo/lapack-netlib/SRC/cposvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cposvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cpotrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/cpotri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotri.f.o"
+  "/root/repo/lapack-netlib/SRC/cpotrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cppcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppcon.f.o"
+  "/root/repo/lapack-netlib/SRC/cppequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppequ.f.o"
+  "/root/repo/lapack-netlib/SRC/cpprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cppsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cppsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cpptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cpptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptri.f.o"
+  "/root/repo/lapack-netlib/SRC/cpptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cpstf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpstf2.f.o"
+  "/root/repo/lapack-netlib/SRC/cpstrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpstrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cptcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptcon.f.o"
+  "/root/repo/lapack-netlib/SRC/cpteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cptrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cptsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cptsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/cpttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/cpttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/cptts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptts2.f.o"
+  "/root/repo/lapack-netlib/SRC/crot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/crot.f.o"
+  "/root/repo/lapack-netlib/SRC/cspcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspcon.f.o"
+  "/root/repo/lapack-netlib/SRC/csprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/cspsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspsv.f.o"
+  "/root/repo/lapack-netlib/SRC/cspsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/csptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/csptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptri.f.o"
+  "/root/repo/lapack-netlib/SRC/csptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/csrscl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csrscl.f.o"
+  "/root/repo/lapack-netlib/SRC/cstedc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstedc.f.o"
+  "/root/repo/lapack-netlib/SRC/cstegr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstegr.f.o"
+  "/root/repo/lapack-netlib/SRC/cstein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstein.f.o"
+  "/root/repo/lapack-netlib/SRC/cstemr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstemr.f.o"
+  "/root/repo/lapack-netlib/SRC/csteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/csycon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon.f.o"
+  "/root/repo/lapack-netlib/SRC/csycon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/csycon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csyconv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconv.f.o"
+  "/root/repo/lapack-netlib/SRC/csyconvf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconvf.f.o"
+  "/root/repo/lapack-netlib/SRC/csyconvf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconvf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csyequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyequb.f.o"
+  "/root/repo/lapack-netlib/SRC/csyrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/csysv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv.f.o"
+  "/root/repo/lapack-netlib/SRC/csysv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/csysv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/csysv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/csysv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csysvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysvx.f.o"
+  "/root/repo/lapack-netlib/SRC/csyswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/csytf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2.f.o"
+  "/root/repo/lapack-netlib/SRC/csytf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/csytf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri2.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/csytri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/csytrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ctbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ctbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctfsm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfsm.f.o"
+  "/root/repo/lapack-netlib/SRC/ctftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctftri.f.o"
+  "/root/repo/lapack-netlib/SRC/ctfttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfttp.f.o"
+  "/root/repo/lapack-netlib/SRC/ctfttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfttr.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgevc.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgex2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgex2.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgexc.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsen.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgsja.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsja.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsna.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgsy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsy2.f.o"
+  "/root/repo/lapack-netlib/SRC/ctgsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ctplqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctplqt.f.o"
+  "/root/repo/lapack-netlib/SRC/ctplqt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctplqt2.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpmlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpmlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpmqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpmqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/ctprfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctprfb.f.o"
+  "/root/repo/lapack-netlib/SRC/ctprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctptri.f.o"
+  "/root/repo/lapack-netlib/SRC/ctptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpttf.f.o"
+  "/root/repo/lapack-netlib/SRC/ctpttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpttr.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrevc.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrevc3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrevc3.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrexc.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsen.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsna.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrttf.f.o"
+  "/root/repo/lapack-netlib/SRC/ctrttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrttp.f.o"
+  "/root/repo/lapack-netlib/SRC/ctzrzf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctzrzf.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb1.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb2.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb3.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb4.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb5.f.o"
+  "/root/repo/lapack-netlib/SRC/cunbdb6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb6.f.o"
+  "/root/repo/lapack-netlib/SRC/cuncsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cuncsd.f.o"
+  "/root/repo/lapack-netlib/SRC/cuncsd2by1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cuncsd2by1.f.o"
+  "/root/repo/lapack-netlib/SRC/cung2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cung2l.f.o"
+  "/root/repo/lapack-netlib/SRC/cung2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cung2r.f.o"
+  "/root/repo/lapack-netlib/SRC/cungbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungbr.f.o"
+  "/root/repo/lapack-netlib/SRC/cunghr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunghr.f.o"
+  "/root/repo/lapack-netlib/SRC/cungl2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungl2.f.o"
+  "/root/repo/lapack-netlib/SRC/cunglq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunglq.f.o"
+  "/root/repo/lapack-netlib/SRC/cungql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungql.f.o"
+  "/root/repo/lapack-netlib/SRC/cungqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cungr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungr2.f.o"
+  "/root/repo/lapack-netlib/SRC/cungrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungrq.f.o"
+  "/root/repo/lapack-netlib/SRC/cungtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtr.f.o"
+  "/root/repo/lapack-netlib/SRC/cungtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cungtsqr_row.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtsqr_row.f.o"
+  "/root/repo/lapack-netlib/SRC/cunhr_col.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunhr_col.f.o"
+  "/root/repo/lapack-netlib/SRC/cunm22.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm22.f.o"
+  "/root/repo/lapack-netlib/SRC/cunm2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm2l.f.o"
+  "/root/repo/lapack-netlib/SRC/cunm2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm2r.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmbr.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmhr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmhr.f.o"
+  "/root/repo/lapack-netlib/SRC/cunml2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunml2.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmlq.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmql.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmqr.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmr2.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmr3.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmrq.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmrz.f.o"
+  "/root/repo/lapack-netlib/SRC/cunmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmtr.f.o"
+  "/root/repo/lapack-netlib/SRC/cupgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cupgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/cupmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cupmtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dbbcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbbcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/dbdsdc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsdc.f.o"
+  "/root/repo/lapack-netlib/SRC/dbdsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dbdsvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/dcombssq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dcombssq.f.o"
+  "/root/repo/lapack-netlib/SRC/ddisna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ddisna.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbbrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbbrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbequb.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dgbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dgebak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebak.f.o"
+  "/root/repo/lapack-netlib/SRC/dgebal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebal.f.o"
+  "/root/repo/lapack-netlib/SRC/dgebd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebd2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgebrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgecon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgecon.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeequ.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeequb.f.o"
+  "/root/repo/lapack-netlib/SRC/dgees.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgees.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeesx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeev.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgehd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgehd2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgehrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgehrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgejsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgejsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelq.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelq2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqf.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqt.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelqt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqt3.f.o"
+  "/root/repo/lapack-netlib/SRC/dgels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgels.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelsd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelss.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelss.f.o"
+  "/root/repo/lapack-netlib/SRC/dgelsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelsy.f.o"
+  "/root/repo/lapack-netlib/SRC/dgemlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemlq.f.o"
+  "/root/repo/lapack-netlib/SRC/dgemlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/dgemqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dgemqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeql2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeql2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqlf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqlf.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqp3.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqr2p.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr2p.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqrfp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrfp.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgeqrt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt3.f.o"
+  "/root/repo/lapack-netlib/SRC/dgerfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dgerq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerq2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgerqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerqf.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesc2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesdd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesdd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesvdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvdq.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesvj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvj.f.o"
+  "/root/repo/lapack-netlib/SRC/dgesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgetc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetc2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgetrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dgetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetri.f.o"
+  "/root/repo/lapack-netlib/SRC/dgetsls.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetsls.f.o"
+  "/root/repo/lapack-netlib/SRC/dgetsqrhrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetsqrhrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dggbak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggbak.f.o"
+  "/root/repo/lapack-netlib/SRC/dggbal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggbal.f.o"
+  "/root/repo/lapack-netlib/SRC/dgges.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgges.f.o"
+  "/root/repo/lapack-netlib/SRC/dgges3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgges3.f.o"
+  "/root/repo/lapack-netlib/SRC/dggesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggesx.f.o"
+  "/root/repo/lapack-netlib/SRC/dggev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggev.f.o"
+  "/root/repo/lapack-netlib/SRC/dggev3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggev3.f.o"
+  "/root/repo/lapack-netlib/SRC/dggevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dggglm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggglm.f.o"
+  "/root/repo/lapack-netlib/SRC/dgghd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgghd3.f.o"
+  "/root/repo/lapack-netlib/SRC/dgghrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgghrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dgglse.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgglse.f.o"
+  "/root/repo/lapack-netlib/SRC/dggqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dggrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/dggsvd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggsvd3.f.o"
+  "/root/repo/lapack-netlib/SRC/dggsvp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggsvp3.f.o"
+  "/root/repo/lapack-netlib/SRC/dgsvj0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgsvj0.f.o"
+  "/root/repo/lapack-netlib/SRC/dgsvj1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgsvj1.f.o"
+  "/root/repo/lapack-netlib/SRC/dgtcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dgtrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dgtsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dgtsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dgttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dgttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dgtts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtts2.f.o"
+  "/root/repo/lapack-netlib/SRC/dhgeqz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhgeqz.f.o"
+  "/root/repo/lapack-netlib/SRC/dhsein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhsein.f.o"
+  "/root/repo/lapack-netlib/SRC/dhseqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhseqr.f.o"
+  "/root/repo/lapack-netlib/SRC/disnan.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/disnan.f.o"
+  "/root/repo/lapack-netlib/SRC/dlabad.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlabad.f.o"
+  "/root/repo/lapack-netlib/SRC/dlabrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlabrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dlacn2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacn2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlacon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacon.f.o"
+  "/root/repo/lapack-netlib/SRC/dlacpy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacpy.f.o"
+  "/root/repo/lapack-netlib/SRC/dladiv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dladiv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlae2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlae2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaebz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaebz.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed0.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed1.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed3.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed4.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed5.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed6.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed7.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed8.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaed9.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed9.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaeda.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaeda.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaein.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaev2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaev2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaexc.f.o"
+  "/root/repo/lapack-netlib/SRC/dlag2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlag2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlag2s.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlag2s.f.o"
+  "/root/repo/lapack-netlib/SRC/dlags2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlags2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlagtf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagtf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlagtm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagtm.f.o"
+  "/root/repo/lapack-netlib/SRC/dlagts.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagts.f.o"
+  "/root/repo/lapack-netlib/SRC/dlagv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagv2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlahqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlahqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlahr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlahr2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaic1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaic1.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaisnan.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaisnan.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaln2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaln2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlals0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlals0.f.o"
+  "/root/repo/lapack-netlib/SRC/dlalsa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlalsa.f.o"
+  "/root/repo/lapack-netlib/SRC/dlalsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlalsd.f.o"
+  "/root/repo/lapack-netlib/SRC/dlamrg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamrg.f.o"
+  "/root/repo/lapack-netlib/SRC/dlamswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/dlamtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaneg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaneg.f.o"
+  "/root/repo/lapack-netlib/SRC/dlangb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlangb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlange.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlange.f.o"
+  "/root/repo/lapack-netlib/SRC/dlangt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlangt.f.o"
+  "/root/repo/lapack-netlib/SRC/dlanhs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanhs.f.o"
+  "/root/repo/lapack-netlib/SRC/dlansb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlansf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlansp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlanst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanst.f.o"
+  "/root/repo/lapack-netlib/SRC/dlansy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansy.f.o"
+  "/root/repo/lapack-netlib/SRC/dlantb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlantp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlantr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlanv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanv2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaorhr_col_getrfnp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaorhr_col_getrfnp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaorhr_col_getrfnp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaorhr_col_getrfnp2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlapll.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapll.f.o"
+  "/root/repo/lapack-netlib/SRC/dlapmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapmr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlapmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapmt.f.o"
+  "/root/repo/lapack-netlib/SRC/dlapy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapy2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlapy3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapy3.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqgb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqgb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqge.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqp2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqps.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr0.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr1.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr3.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr4.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqr5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr5.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqsb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqsp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsy.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaqtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlar1v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlar1v.f.o"
+  "/root/repo/lapack-netlib/SRC/dlar2v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlar2v.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfb_gett.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfb_gett.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfg.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfgp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarft.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarft.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfx.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarfy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfy.f.o"
+  "/root/repo/lapack-netlib/SRC/dlargv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlargv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarnv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarnv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarra.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarra.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrc.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarre.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarre.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrj.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrk.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarrv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlartg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartg.f.o"
+  "/root/repo/lapack-netlib/SRC/dlartgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartgp.f.o"
+  "/root/repo/lapack-netlib/SRC/dlartgs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartgs.f.o"
+  "/root/repo/lapack-netlib/SRC/dlartv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaruv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaruv.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarz.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarzb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarzb.f.o"
+  "/root/repo/lapack-netlib/SRC/dlarzt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarzt.f.o"
+  "/root/repo/lapack-netlib/SRC/dlas2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlas2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlascl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlascl.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd0.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd1.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd3.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd4.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd5.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd6.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd7.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasd8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd8.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasda.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasda.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasdq.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasdt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasdt.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaset.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaset.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq1.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq3.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq4.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq5.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasq6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq6.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasr.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dlassq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlassq.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasv2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlaswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasy2.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasyf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasyf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasyf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/dlasyf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dlat2s.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlat2s.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatbs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatbs.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatdf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatdf.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatps.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrz.f.o"
+  "/root/repo/lapack-netlib/SRC/dlatsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dopgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dopgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dopmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dopmtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb1.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb2.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb3.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb4.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb5.f.o"
+  "/root/repo/lapack-netlib/SRC/dorbdb6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb6.f.o"
+  "/root/repo/lapack-netlib/SRC/dorcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/dorcsd2by1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorcsd2by1.f.o"
+  "/root/repo/lapack-netlib/SRC/dorg2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorg2l.f.o"
+  "/root/repo/lapack-netlib/SRC/dorg2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorg2r.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgbr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorghr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorghr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgl2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgl2.f.o"
+  "/root/repo/lapack-netlib/SRC/dorglq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorglq.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgql.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgr2.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgrq.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorgtsqr_row.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtsqr_row.f.o"
+  "/root/repo/lapack-netlib/SRC/dorhr_col.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorhr_col.f.o"
+  "/root/repo/lapack-netlib/SRC/dorm22.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm22.f.o"
+  "/root/repo/lapack-netlib/SRC/dorm2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm2l.f.o"
+  "/root/repo/lapack-netlib/SRC/dorm2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm2r.f.o"
+  "/root/repo/lapack-netlib/SRC/dormbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormbr.f.o"
+  "/root/repo/lapack-netlib/SRC/dormhr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormhr.f.o"
+  "/root/repo/lapack-netlib/SRC/dorml2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorml2.f.o"
+  "/root/repo/lapack-netlib/SRC/dormlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormlq.f.o"
+  "/root/repo/lapack-netlib/SRC/dormql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormql.f.o"
+  "/root/repo/lapack-netlib/SRC/dormqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dormr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormr2.f.o"
+  "/root/repo/lapack-netlib/SRC/dormr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormr3.f.o"
+  "/root/repo/lapack-netlib/SRC/dormrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormrq.f.o"
+  "/root/repo/lapack-netlib/SRC/dormrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormrz.f.o"
+  "/root/repo/lapack-netlib/SRC/dormtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormtr.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbstf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbstf.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dpbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dpftrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dpftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftri.f.o"
+  "/root/repo/lapack-netlib/SRC/dpftrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dpocon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpocon.f.o"
+  "/root/repo/lapack-netlib/SRC/dpoequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpoequ.f.o"
+  "/root/repo/lapack-netlib/SRC/dpoequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpoequb.f.o"
+  "/root/repo/lapack-netlib/SRC/dporfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dporfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dposv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dposv.f.o"
+  "/root/repo/lapack-netlib/SRC/dposvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dposvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dpotrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dpotri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotri.f.o"
+  "/root/repo/lapack-netlib/SRC/dpotrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dppcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dppequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppequ.f.o"
+  "/root/repo/lapack-netlib/SRC/dpprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dppsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dppsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dpptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dpptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptri.f.o"
+  "/root/repo/lapack-netlib/SRC/dpptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dpstf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpstf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dpstrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpstrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dptcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dpteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dptrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dptsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dptsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dpttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dpttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dptts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptts2.f.o"
+  "/root/repo/lapack-netlib/SRC/drscl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/drscl.f.o"
+  "/root/repo/lapack-netlib/SRC/dsb2st_kernels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsb2st_kernels.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbev.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgst.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgv.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsbtrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbtrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsfrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsfrk.f.o"
+  "/root/repo/lapack-netlib/SRC/dspcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dspev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspev.f.o"
+  "/root/repo/lapack-netlib/SRC/dspevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspevd.f.o"
+  "/root/repo/lapack-netlib/SRC/dspevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dspgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgst.f.o"
+  "/root/repo/lapack-netlib/SRC/dspgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgv.f.o"
+  "/root/repo/lapack-netlib/SRC/dspgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/dspgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dspsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspsv.f.o"
+  "/root/repo/lapack-netlib/SRC/dspsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsptrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dsptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptri.f.o"
+  "/root/repo/lapack-netlib/SRC/dsptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dstebz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstebz.f.o"
+  "/root/repo/lapack-netlib/SRC/dstedc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstedc.f.o"
+  "/root/repo/lapack-netlib/SRC/dstegr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstegr.f.o"
+  "/root/repo/lapack-netlib/SRC/dstein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstein.f.o"
+  "/root/repo/lapack-netlib/SRC/dstemr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstemr.f.o"
+  "/root/repo/lapack-netlib/SRC/dsteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/dsterf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsterf.f.o"
+  "/root/repo/lapack-netlib/SRC/dstev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstev.f.o"
+  "/root/repo/lapack-netlib/SRC/dstevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevd.f.o"
+  "/root/repo/lapack-netlib/SRC/dstevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevr.f.o"
+  "/root/repo/lapack-netlib/SRC/dstevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsycon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon.f.o"
+  "/root/repo/lapack-netlib/SRC/dsycon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/dsycon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyconv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconv.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyconvf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconvf.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyconvf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconvf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyequb.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyev.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevr.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevr_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevr_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygs2.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygst.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygv.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygv_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygv_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygvd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsygvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsysvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysvx.f.o"
+  "/root/repo/lapack-netlib/SRC/dsyswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytd2.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrd_sb2st.F" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_sb2st.F.o"
+  "/root/repo/lapack-netlib/SRC/dsytrd_sy2sb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_sy2sb.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri2.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/dsytrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/dtbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dtbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtfsm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfsm.f.o"
+  "/root/repo/lapack-netlib/SRC/dtftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtftri.f.o"
+  "/root/repo/lapack-netlib/SRC/dtfttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfttp.f.o"
+  "/root/repo/lapack-netlib/SRC/dtfttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfttr.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgevc.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgex2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgex2.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgexc.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsen.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgsja.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsja.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsna.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgsy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsy2.f.o"
+  "/root/repo/lapack-netlib/SRC/dtgsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dtplqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtplqt.f.o"
+  "/root/repo/lapack-netlib/SRC/dtplqt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtplqt2.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpmlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpmlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpmqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpmqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/dtprfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtprfb.f.o"
+  "/root/repo/lapack-netlib/SRC/dtprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtptri.f.o"
+  "/root/repo/lapack-netlib/SRC/dtptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpttf.f.o"
+  "/root/repo/lapack-netlib/SRC/dtpttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpttr.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrcon.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrevc.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrevc3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrevc3.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrexc.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsen.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsna.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrttf.f.o"
+  "/root/repo/lapack-netlib/SRC/dtrttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrttp.f.o"
+  "/root/repo/lapack-netlib/SRC/dtzrzf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtzrzf.f.o"
+  "/root/repo/lapack-netlib/SRC/dzsum1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dzsum1.f.o"
+  "/root/repo/lapack-netlib/SRC/icmax1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/icmax1.f.o"
+  "/root/repo/lapack-netlib/SRC/ieeeck.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ieeeck.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaclc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaclc.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaclr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaclr.f.o"
+  "/root/repo/lapack-netlib/SRC/iladiag.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladiag.f.o"
+  "/root/repo/lapack-netlib/SRC/iladlc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladlc.f.o"
+  "/root/repo/lapack-netlib/SRC/iladlr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladlr.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaenv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaenv.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaenv2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaenv2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaprec.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaprec.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaslc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaslc.f.o"
+  "/root/repo/lapack-netlib/SRC/ilaslr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaslr.f.o"
+  "/root/repo/lapack-netlib/SRC/ilatrans.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilatrans.f.o"
+  "/root/repo/lapack-netlib/SRC/ilauplo.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilauplo.f.o"
+  "/root/repo/lapack-netlib/SRC/ilazlc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilazlc.f.o"
+  "/root/repo/lapack-netlib/SRC/ilazlr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilazlr.f.o"
+  "/root/repo/lapack-netlib/SRC/iparam2stage.F" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iparam2stage.F.o"
+  "/root/repo/lapack-netlib/SRC/iparmq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iparmq.f.o"
+  "/root/repo/lapack-netlib/SRC/izmax1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/izmax1.f.o"
+  "/root/repo/lapack-netlib/SRC/lsamen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/lsamen.f.o"
+  "/root/repo/lapack-netlib/SRC/sbbcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbbcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/sbdsdc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsdc.f.o"
+  "/root/repo/lapack-netlib/SRC/sbdsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sbdsvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/scombssq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/scombssq.f.o"
+  "/root/repo/lapack-netlib/SRC/scsum1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/scsum1.f.o"
+  "/root/repo/lapack-netlib/SRC/sdisna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sdisna.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbbrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbbrd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbequb.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/sgbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/sgebak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebak.f.o"
+  "/root/repo/lapack-netlib/SRC/sgebal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebal.f.o"
+  "/root/repo/lapack-netlib/SRC/sgebd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebd2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgebrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebrd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgecon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgecon.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeequ.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeequb.f.o"
+  "/root/repo/lapack-netlib/SRC/sgees.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgees.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeesx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeev.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeevx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgehd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgehd2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgehrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgehrd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgejsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgejsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelq.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelq2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqf.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqt.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelqt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqt3.f.o"
+  "/root/repo/lapack-netlib/SRC/sgels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgels.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelsd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelss.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelss.f.o"
+  "/root/repo/lapack-netlib/SRC/sgelsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelsy.f.o"
+  "/root/repo/lapack-netlib/SRC/sgemlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemlq.f.o"
+  "/root/repo/lapack-netlib/SRC/sgemlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/sgemqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sgemqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeql2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeql2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqlf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqlf.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqp3.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqr2p.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr2p.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqrfp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrfp.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgeqrt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt3.f.o"
+  "/root/repo/lapack-netlib/SRC/sgerfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sgerq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerq2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgerqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerqf.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesc2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesdd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesdd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesvdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvdq.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesvj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvj.f.o"
+  "/root/repo/lapack-netlib/SRC/sgesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgetc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetc2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgetrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/sgetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetri.f.o"
+  "/root/repo/lapack-netlib/SRC/sgetsls.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetsls.f.o"
+  "/root/repo/lapack-netlib/SRC/sgetsqrhrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetsqrhrt.f.o"
+  "/root/repo/lapack-netlib/SRC/sggbak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggbak.f.o"
+  "/root/repo/lapack-netlib/SRC/sggbal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggbal.f.o"
+  "/root/repo/lapack-netlib/SRC/sgges.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgges.f.o"
+  "/root/repo/lapack-netlib/SRC/sgges3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgges3.f.o"
+  "/root/repo/lapack-netlib/SRC/sggesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggesx.f.o"
+  "/root/repo/lapack-netlib/SRC/sggev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggev.f.o"
+  "/root/repo/lapack-netlib/SRC/sggev3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggev3.f.o"
+  "/root/repo/lapack-netlib/SRC/sggevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggevx.f.o"
+  "/root/repo/lapack-netlib/SRC/sggglm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggglm.f.o"
+  "/root/repo/lapack-netlib/SRC/sgghd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgghd3.f.o"
+  "/root/repo/lapack-netlib/SRC/sgghrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgghrd.f.o"
+  "/root/repo/lapack-netlib/SRC/sgglse.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgglse.f.o"
+  "/root/repo/lapack-netlib/SRC/sggqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/sggrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/sggsvd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggsvd3.f.o"
+  "/root/repo/lapack-netlib/SRC/sggsvp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggsvp3.f.o"
+  "/root/repo/lapack-netlib/SRC/sgsvj0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgsvj0.f.o"
+  "/root/repo/lapack-netlib/SRC/sgsvj1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgsvj1.f.o"
+  "/root/repo/lapack-netlib/SRC/sgtcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtcon.f.o"
+  "/root/repo/lapack-netlib/SRC/sgtrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sgtsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sgtsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/sgttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/sgttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/sgtts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtts2.f.o"
+  "/root/repo/lapack-netlib/SRC/shgeqz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shgeqz.f.o"
+  "/root/repo/lapack-netlib/SRC/shsein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shsein.f.o"
+  "/root/repo/lapack-netlib/SRC/shseqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shseqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sisnan.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sisnan.f.o"
+  "/root/repo/lapack-netlib/SRC/slabad.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slabad.f.o"
+  "/root/repo/lapack-netlib/SRC/slabrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slabrd.f.o"
+  "/root/repo/lapack-netlib/SRC/slacn2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacn2.f.o"
+  "/root/repo/lapack-netlib/SRC/slacon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacon.f.o"
+  "/root/repo/lapack-netlib/SRC/slacpy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacpy.f.o"
+  "/root/repo/lapack-netlib/SRC/sladiv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sladiv.f.o"
+  "/root/repo/lapack-netlib/SRC/slae2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slae2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaebz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaebz.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed0.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed1.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed3.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed4.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed5.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed6.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed7.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed8.f.o"
+  "/root/repo/lapack-netlib/SRC/slaed9.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed9.f.o"
+  "/root/repo/lapack-netlib/SRC/slaeda.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaeda.f.o"
+  "/root/repo/lapack-netlib/SRC/slaein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaein.f.o"
+  "/root/repo/lapack-netlib/SRC/slaev2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaev2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaexc.f.o"
+  "/root/repo/lapack-netlib/SRC/slag2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slag2.f.o"
+  "/root/repo/lapack-netlib/SRC/slag2d.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slag2d.f.o"
+  "/root/repo/lapack-netlib/SRC/slags2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slags2.f.o"
+  "/root/repo/lapack-netlib/SRC/slagtf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagtf.f.o"
+  "/root/repo/lapack-netlib/SRC/slagtm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagtm.f.o"
+  "/root/repo/lapack-netlib/SRC/slagts.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagts.f.o"
+  "/root/repo/lapack-netlib/SRC/slagv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagv2.f.o"
+  "/root/repo/lapack-netlib/SRC/slahqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slahqr.f.o"
+  "/root/repo/lapack-netlib/SRC/slahr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slahr2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaic1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaic1.f.o"
+  "/root/repo/lapack-netlib/SRC/slaisnan.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaisnan.f.o"
+  "/root/repo/lapack-netlib/SRC/slaln2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaln2.f.o"
+  "/root/repo/lapack-netlib/SRC/slals0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slals0.f.o"
+  "/root/repo/lapack-netlib/SRC/slalsa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slalsa.f.o"
+  "/root/repo/lapack-netlib/SRC/slalsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slalsd.f.o"
+  "/root/repo/lapack-netlib/SRC/slamrg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamrg.f.o"
+  "/root/repo/lapack-netlib/SRC/slamswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/slamtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/slaneg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaneg.f.o"
+  "/root/repo/lapack-netlib/SRC/slangb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slangb.f.o"
+  "/root/repo/lapack-netlib/SRC/slange.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slange.f.o"
+  "/root/repo/lapack-netlib/SRC/slangt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slangt.f.o"
+  "/root/repo/lapack-netlib/SRC/slanhs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanhs.f.o"
+  "/root/repo/lapack-netlib/SRC/slansb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansb.f.o"
+  "/root/repo/lapack-netlib/SRC/slansf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansf.f.o"
+  "/root/repo/lapack-netlib/SRC/slansp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansp.f.o"
+  "/root/repo/lapack-netlib/SRC/slanst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanst.f.o"
+  "/root/repo/lapack-netlib/SRC/slansy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansy.f.o"
+  "/root/repo/lapack-netlib/SRC/slantb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantb.f.o"
+  "/root/repo/lapack-netlib/SRC/slantp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantp.f.o"
+  "/root/repo/lapack-netlib/SRC/slantr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantr.f.o"
+  "/root/repo/lapack-netlib/SRC/slanv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanv2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaorhr_col_getrfnp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaorhr_col_getrfnp.f.o"
+  "/root/repo/lapack-netlib/SRC/slaorhr_col_getrfnp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaorhr_col_getrfnp2.f.o"
+  "/root/repo/lapack-netlib/SRC/slapll.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapll.f.o"
+  "/root/repo/lapack-netlib/SRC/slapmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapmr.f.o"
+  "/root/repo/lapack-netlib/SRC/slapmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapmt.f.o"
+  "/root/repo/lapack-netlib/SRC/slapy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapy2.f.o"
+  "/root/repo/lapack-netlib/SRC/slapy3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapy3.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqgb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqgb.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqge.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqp2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqps.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr0.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr1.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr3.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr4.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqr5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr5.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqsb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsb.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqsp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsp.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsy.f.o"
+  "/root/repo/lapack-netlib/SRC/slaqtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqtr.f.o"
+  "/root/repo/lapack-netlib/SRC/slar1v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slar1v.f.o"
+  "/root/repo/lapack-netlib/SRC/slar2v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slar2v.f.o"
+  "/root/repo/lapack-netlib/SRC/slarf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarf.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfb.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfb_gett.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfb_gett.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfg.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfgp.f.o"
+  "/root/repo/lapack-netlib/SRC/slarft.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarft.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfx.f.o"
+  "/root/repo/lapack-netlib/SRC/slarfy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfy.f.o"
+  "/root/repo/lapack-netlib/SRC/slargv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slargv.f.o"
+  "/root/repo/lapack-netlib/SRC/slarnv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarnv.f.o"
+  "/root/repo/lapack-netlib/SRC/slarra.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarra.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrb.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrc.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrd.f.o"
+  "/root/repo/lapack-netlib/SRC/slarre.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarre.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrf.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrj.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrk.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrr.f.o"
+  "/root/repo/lapack-netlib/SRC/slarrv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrv.f.o"
+  "/root/repo/lapack-netlib/SRC/slartg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartg.f.o"
+  "/root/repo/lapack-netlib/SRC/slartgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartgp.f.o"
+  "/root/repo/lapack-netlib/SRC/slartgs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartgs.f.o"
+  "/root/repo/lapack-netlib/SRC/slartv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartv.f.o"
+  "/root/repo/lapack-netlib/SRC/slaruv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaruv.f.o"
+  "/root/repo/lapack-netlib/SRC/slarz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarz.f.o"
+  "/root/repo/lapack-netlib/SRC/slarzb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarzb.f.o"
+  "/root/repo/lapack-netlib/SRC/slarzt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarzt.f.o"
+  "/root/repo/lapack-netlib/SRC/slas2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slas2.f.o"
+  "/root/repo/lapack-netlib/SRC/slascl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slascl.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd0.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd1.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd2.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd3.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd4.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd5.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd6.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd7.f.o"
+  "/root/repo/lapack-netlib/SRC/slasd8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd8.f.o"
+  "/root/repo/lapack-netlib/SRC/slasda.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasda.f.o"
+  "/root/repo/lapack-netlib/SRC/slasdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasdq.f.o"
+  "/root/repo/lapack-netlib/SRC/slasdt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasdt.f.o"
+  "/root/repo/lapack-netlib/SRC/slaset.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaset.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq1.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq2.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq3.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq4.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq5.f.o"
+  "/root/repo/lapack-netlib/SRC/slasq6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq6.f.o"
+  "/root/repo/lapack-netlib/SRC/slasr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasr.f.o"
+  "/root/repo/lapack-netlib/SRC/slasrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasrt.f.o"
+  "/root/repo/lapack-netlib/SRC/slassq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slassq.f.o"
+  "/root/repo/lapack-netlib/SRC/slasv2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasv2.f.o"
+  "/root/repo/lapack-netlib/SRC/slaswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/slasy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasy2.f.o"
+  "/root/repo/lapack-netlib/SRC/slasyf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf.f.o"
+  "/root/repo/lapack-netlib/SRC/slasyf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/slasyf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/slasyf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/slatbs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatbs.f.o"
+  "/root/repo/lapack-netlib/SRC/slatdf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatdf.f.o"
+  "/root/repo/lapack-netlib/SRC/slatps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatps.f.o"
+  "/root/repo/lapack-netlib/SRC/slatrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrd.f.o"
+  "/root/repo/lapack-netlib/SRC/slatrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrs.f.o"
+  "/root/repo/lapack-netlib/SRC/slatrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrz.f.o"
+  "/root/repo/lapack-netlib/SRC/slatsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sopgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sopgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/sopmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sopmtr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb1.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb2.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb3.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb4.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb5.f.o"
+  "/root/repo/lapack-netlib/SRC/sorbdb6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb6.f.o"
+  "/root/repo/lapack-netlib/SRC/sorcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/sorcsd2by1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorcsd2by1.f.o"
+  "/root/repo/lapack-netlib/SRC/sorg2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorg2l.f.o"
+  "/root/repo/lapack-netlib/SRC/sorg2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorg2r.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgbr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorghr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorghr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgl2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgl2.f.o"
+  "/root/repo/lapack-netlib/SRC/sorglq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorglq.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgql.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgr2.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgrq.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorgtsqr_row.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtsqr_row.f.o"
+  "/root/repo/lapack-netlib/SRC/sorhr_col.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorhr_col.f.o"
+  "/root/repo/lapack-netlib/SRC/sorm22.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm22.f.o"
+  "/root/repo/lapack-netlib/SRC/sorm2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm2l.f.o"
+  "/root/repo/lapack-netlib/SRC/sorm2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm2r.f.o"
+  "/root/repo/lapack-netlib/SRC/sormbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormbr.f.o"
+  "/root/repo/lapack-netlib/SRC/sormhr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormhr.f.o"
+  "/root/repo/lapack-netlib/SRC/sorml2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorml2.f.o"
+  "/root/repo/lapack-netlib/SRC/sormlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormlq.f.o"
+  "/root/repo/lapack-netlib/SRC/sormql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormql.f.o"
+  "/root/repo/lapack-netlib/SRC/sormqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sormr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormr2.f.o"
+  "/root/repo/lapack-netlib/SRC/sormr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormr3.f.o"
+  "/root/repo/lapack-netlib/SRC/sormrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormrq.f.o"
+  "/root/repo/lapack-netlib/SRC/sormrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormrz.f.o"
+  "/root/repo/lapack-netlib/SRC/sormtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormtr.f.o"
+  "/root/repo/lapack-netlib/SRC/spbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/spbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/spbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/spbstf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbstf.f.o"
+  "/root/repo/lapack-netlib/SRC/spbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/spbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/spbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/spbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/spbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/spftrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftrf.f.o"
+  "/root/repo/lapack-netlib/SRC/spftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftri.f.o"
+  "/root/repo/lapack-netlib/SRC/spftrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftrs.f.o"
+  "/root/repo/lapack-netlib/SRC/spocon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spocon.f.o"
+  "/root/repo/lapack-netlib/SRC/spoequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spoequ.f.o"
+  "/root/repo/lapack-netlib/SRC/spoequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spoequb.f.o"
+  "/root/repo/lapack-netlib/SRC/sporfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sporfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sposv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sposv.f.o"
+  "/root/repo/lapack-netlib/SRC/sposvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sposvx.f.o"
+  "/root/repo/lapack-netlib/SRC/spotrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/spotri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotri.f.o"
+  "/root/repo/lapack-netlib/SRC/spotrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotrs.f.o"
+  "/root/repo/lapack-netlib/SRC/sppcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppcon.f.o"
+  "/root/repo/lapack-netlib/SRC/sppequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppequ.f.o"
+  "/root/repo/lapack-netlib/SRC/spprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sppsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sppsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/spptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/spptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptri.f.o"
+  "/root/repo/lapack-netlib/SRC/spptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/spstf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spstf2.f.o"
+  "/root/repo/lapack-netlib/SRC/spstrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spstrf.f.o"
+  "/root/repo/lapack-netlib/SRC/sptcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptcon.f.o"
+  "/root/repo/lapack-netlib/SRC/spteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/sptrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sptsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sptsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/spttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/spttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/sptts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptts2.f.o"
+  "/root/repo/lapack-netlib/SRC/srscl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/srscl.f.o"
+  "/root/repo/lapack-netlib/SRC/ssb2st_kernels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssb2st_kernels.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbev.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgst.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgv.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssbtrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbtrd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssfrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssfrk.f.o"
+  "/root/repo/lapack-netlib/SRC/sspcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspcon.f.o"
+  "/root/repo/lapack-netlib/SRC/sspev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspev.f.o"
+  "/root/repo/lapack-netlib/SRC/sspevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspevd.f.o"
+  "/root/repo/lapack-netlib/SRC/sspevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspevx.f.o"
+  "/root/repo/lapack-netlib/SRC/sspgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgst.f.o"
+  "/root/repo/lapack-netlib/SRC/sspgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgv.f.o"
+  "/root/repo/lapack-netlib/SRC/sspgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/sspgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/sspsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspsv.f.o"
+  "/root/repo/lapack-netlib/SRC/sspsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssptrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/ssptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptri.f.o"
+  "/root/repo/lapack-netlib/SRC/ssptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/sstebz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstebz.f.o"
+  "/root/repo/lapack-netlib/SRC/sstedc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstedc.f.o"
+  "/root/repo/lapack-netlib/SRC/sstegr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstegr.f.o"
+  "/root/repo/lapack-netlib/SRC/sstein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstein.f.o"
+  "/root/repo/lapack-netlib/SRC/sstemr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstemr.f.o"
+  "/root/repo/lapack-netlib/SRC/ssteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/ssterf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssterf.f.o"
+  "/root/repo/lapack-netlib/SRC/sstev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstev.f.o"
+  "/root/repo/lapack-netlib/SRC/sstevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevd.f.o"
+  "/root/repo/lapack-netlib/SRC/sstevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevr.f.o"
+  "/root/repo/lapack-netlib/SRC/sstevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssycon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon.f.o"
+  "/root/repo/lapack-netlib/SRC/ssycon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/ssycon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyconv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconv.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyconvf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconvf.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyconvf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconvf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyequb.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyev.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevr.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevr_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevr_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygs2.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygst.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygv.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygv_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygv_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygvd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssygvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygvx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssysvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysvx.f.o"
+  "/root/repo/lapack-netlib/SRC/ssyswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytd2.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrd_sb2st.F" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_sb2st.F.o"
+  "/root/repo/lapack-netlib/SRC/ssytrd_sy2sb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_sy2sb.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri2.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/ssytrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/stbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/stbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/stbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/stfsm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfsm.f.o"
+  "/root/repo/lapack-netlib/SRC/stftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stftri.f.o"
+  "/root/repo/lapack-netlib/SRC/stfttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfttp.f.o"
+  "/root/repo/lapack-netlib/SRC/stfttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfttr.f.o"
+  "/root/repo/lapack-netlib/SRC/stgevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgevc.f.o"
+  "/root/repo/lapack-netlib/SRC/stgex2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgex2.f.o"
+  "/root/repo/lapack-netlib/SRC/stgexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgexc.f.o"
+  "/root/repo/lapack-netlib/SRC/stgsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsen.f.o"
+  "/root/repo/lapack-netlib/SRC/stgsja.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsja.f.o"
+  "/root/repo/lapack-netlib/SRC/stgsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsna.f.o"
+  "/root/repo/lapack-netlib/SRC/stgsy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsy2.f.o"
+  "/root/repo/lapack-netlib/SRC/stgsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/stpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/stplqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stplqt.f.o"
+  "/root/repo/lapack-netlib/SRC/stplqt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stplqt2.f.o"
+  "/root/repo/lapack-netlib/SRC/stpmlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpmlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/stpmqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpmqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/stpqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/stpqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/stprfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stprfb.f.o"
+  "/root/repo/lapack-netlib/SRC/stprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/stptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stptri.f.o"
+  "/root/repo/lapack-netlib/SRC/stptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/stpttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpttf.f.o"
+  "/root/repo/lapack-netlib/SRC/stpttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpttr.f.o"
+  "/root/repo/lapack-netlib/SRC/strcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strcon.f.o"
+  "/root/repo/lapack-netlib/SRC/strevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strevc.f.o"
+  "/root/repo/lapack-netlib/SRC/strevc3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strevc3.f.o"
+  "/root/repo/lapack-netlib/SRC/strexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strexc.f.o"
+  "/root/repo/lapack-netlib/SRC/strrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/strsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsen.f.o"
+  "/root/repo/lapack-netlib/SRC/strsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsna.f.o"
+  "/root/repo/lapack-netlib/SRC/strsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/strtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/strttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strttf.f.o"
+  "/root/repo/lapack-netlib/SRC/strttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strttp.f.o"
+  "/root/repo/lapack-netlib/SRC/stzrzf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stzrzf.f.o"
+  "/root/repo/lapack-netlib/SRC/xerbla_array.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/xerbla_array.f.o"
+  "/root/repo/lapack-netlib/SRC/zbbcsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zbbcsd.f.o"
+  "/root/repo/lapack-netlib/SRC/zbdsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zbdsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zcgesv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zcgesv.f.o"
+  "/root/repo/lapack-netlib/SRC/zcposv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zcposv.f.o"
+  "/root/repo/lapack-netlib/SRC/zdrscl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zdrscl.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbbrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbbrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbequb.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zgebak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebak.f.o"
+  "/root/repo/lapack-netlib/SRC/zgebal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebal.f.o"
+  "/root/repo/lapack-netlib/SRC/zgebd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebd2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgebrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgecon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgecon.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeequ.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeequb.f.o"
+  "/root/repo/lapack-netlib/SRC/zgees.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgees.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeesx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeev.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeevx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgehd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgehd2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgehrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgehrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgejsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgejsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelq.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelq2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqt.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelqt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqt3.f.o"
+  "/root/repo/lapack-netlib/SRC/zgels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgels.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelsd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelss.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelss.f.o"
+  "/root/repo/lapack-netlib/SRC/zgelsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelsy.f.o"
+  "/root/repo/lapack-netlib/SRC/zgemlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemlq.f.o"
+  "/root/repo/lapack-netlib/SRC/zgemlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/zgemqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zgemqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeql2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeql2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqlf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqlf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqp3.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqr2p.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr2p.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqrfp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrfp.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgeqrt3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt3.f.o"
+  "/root/repo/lapack-netlib/SRC/zgerfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zgerq2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerq2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgerqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerqf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesc2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesdd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesdd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesvdq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvdq.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesvdx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvdx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesvj.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvj.f.o"
+  "/root/repo/lapack-netlib/SRC/zgesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgetc2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetc2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgetrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zgetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetri.f.o"
+  "/root/repo/lapack-netlib/SRC/zgetsls.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetsls.f.o"
+  "/root/repo/lapack-netlib/SRC/zgetsqrhrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetsqrhrt.f.o"
+  "/root/repo/lapack-netlib/SRC/zggbak.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggbak.f.o"
+  "/root/repo/lapack-netlib/SRC/zggbal.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggbal.f.o"
+  "/root/repo/lapack-netlib/SRC/zgges.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgges.f.o"
+  "/root/repo/lapack-netlib/SRC/zgges3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgges3.f.o"
+  "/root/repo/lapack-netlib/SRC/zggesx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggesx.f.o"
+  "/root/repo/lapack-netlib/SRC/zggev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggev.f.o"
+  "/root/repo/lapack-netlib/SRC/zggev3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggev3.f.o"
+  "/root/repo/lapack-netlib/SRC/zggevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggevx.f.o"
+  "/root/repo/lapack-netlib/SRC/zggglm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggglm.f.o"
+  "/root/repo/lapack-netlib/SRC/zgghd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgghd3.f.o"
+  "/root/repo/lapack-netlib/SRC/zgghrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgghrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zgglse.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgglse.f.o"
+  "/root/repo/lapack-netlib/SRC/zggqrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggqrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zggrqf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggrqf.f.o"
+  "/root/repo/lapack-netlib/SRC/zggsvd3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggsvd3.f.o"
+  "/root/repo/lapack-netlib/SRC/zggsvp3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggsvp3.f.o"
+  "/root/repo/lapack-netlib/SRC/zgsvj0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgsvj0.f.o"
+  "/root/repo/lapack-netlib/SRC/zgsvj1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgsvj1.f.o"
+  "/root/repo/lapack-netlib/SRC/zgtcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zgtrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zgtsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zgtsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zgttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zgttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zgtts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtts2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhb2st_kernels.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhb2st_kernels.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbev.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevx.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgst.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgv.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zhbtrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbtrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhecon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon.f.o"
+  "/root/repo/lapack-netlib/SRC/zhecon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zhecon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zheequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheequb.f.o"
+  "/root/repo/lapack-netlib/SRC/zheev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheev.f.o"
+  "/root/repo/lapack-netlib/SRC/zheev_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheev_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevd.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevr.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevr_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevr_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevx.f.o"
+  "/root/repo/lapack-netlib/SRC/zheevx_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevx_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegs2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegst.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegv.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegv_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegv_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegvd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhegvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zherfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zherfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zhesvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zheswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetd2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetd2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrd_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrd_hb2st.F" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_hb2st.F.o"
+  "/root/repo/lapack-netlib/SRC/zhetrd_he2hb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_he2hb.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zhetrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zhfrk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhfrk.f.o"
+  "/root/repo/lapack-netlib/SRC/zhgeqz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhgeqz.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpev.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpev.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpevd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpevd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpevx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpevx.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpgst.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgst.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgv.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpgvd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgvd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpgvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zhprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zhpsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zhptrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zhptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zhptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptri.f.o"
+  "/root/repo/lapack-netlib/SRC/zhptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zhsein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhsein.f.o"
+  "/root/repo/lapack-netlib/SRC/zhseqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhseqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlabrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlabrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacgv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacgv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacn2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacn2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacon.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacp2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacpy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacpy.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacrm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacrm.f.o"
+  "/root/repo/lapack-netlib/SRC/zlacrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacrt.f.o"
+  "/root/repo/lapack-netlib/SRC/zladiv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zladiv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaed0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed0.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaed7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed7.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaed8.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed8.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaein.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaesy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaesy.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaev2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaev2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlag2c.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlag2c.f.o"
+  "/root/repo/lapack-netlib/SRC/zlags2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlags2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlagtm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlagtm.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahef.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahef_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahef_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahef_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlahr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahr2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaic1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaic1.f.o"
+  "/root/repo/lapack-netlib/SRC/zlals0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlals0.f.o"
+  "/root/repo/lapack-netlib/SRC/zlalsa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlalsa.f.o"
+  "/root/repo/lapack-netlib/SRC/zlalsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlalsd.f.o"
+  "/root/repo/lapack-netlib/SRC/zlamswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlamswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/zlamtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlamtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlangb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlangb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlange.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlange.f.o"
+  "/root/repo/lapack-netlib/SRC/zlangt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlangt.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanhb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanhe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhe.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanhf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhf.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanhp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanhs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhs.f.o"
+  "/root/repo/lapack-netlib/SRC/zlanht.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanht.f.o"
+  "/root/repo/lapack-netlib/SRC/zlansb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlansp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlansy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansy.f.o"
+  "/root/repo/lapack-netlib/SRC/zlantb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlantp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlantr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlapll.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapll.f.o"
+  "/root/repo/lapack-netlib/SRC/zlapmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapmr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlapmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapmt.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqgb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqgb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqge.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqhb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqhe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhe.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqhp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqp2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqps.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr0.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr0.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr1.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr2.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr3.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr4.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqr5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr5.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqsb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqsp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaqsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsy.f.o"
+  "/root/repo/lapack-netlib/SRC/zlar1v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlar1v.f.o"
+  "/root/repo/lapack-netlib/SRC/zlar2v.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlar2v.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarcm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarcm.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarf.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfb_gett.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfb_gett.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfg.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfgp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfgp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarft.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarft.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfx.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarfy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfy.f.o"
+  "/root/repo/lapack-netlib/SRC/zlargv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlargv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarnv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarnv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarrv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarrv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlartg.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlartg.f.o"
+  "/root/repo/lapack-netlib/SRC/zlartv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlartv.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarz.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarzb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarzb.f.o"
+  "/root/repo/lapack-netlib/SRC/zlarzt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarzt.f.o"
+  "/root/repo/lapack-netlib/SRC/zlascl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlascl.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaset.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaset.f.o"
+  "/root/repo/lapack-netlib/SRC/zlasr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlassq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlassq.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaswlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaswlq.f.o"
+  "/root/repo/lapack-netlib/SRC/zlasyf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf.f.o"
+  "/root/repo/lapack-netlib/SRC/zlasyf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zlasyf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zlasyf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zlat2c.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlat2c.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatbs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatbs.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatdf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatdf.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatps.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatps.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatrd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrd.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrz.f.o"
+  "/root/repo/lapack-netlib/SRC/zlatsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaunhr_col_getrfnp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaunhr_col_getrfnp.f.o"
+  "/root/repo/lapack-netlib/SRC/zlaunhr_col_getrfnp2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaunhr_col_getrfnp2.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbequ.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbstf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbstf.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbtf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbtrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zpbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zpftrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zpftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftri.f.o"
+  "/root/repo/lapack-netlib/SRC/zpftrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zpocon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpocon.f.o"
+  "/root/repo/lapack-netlib/SRC/zpoequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpoequ.f.o"
+  "/root/repo/lapack-netlib/SRC/zpoequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpoequb.f.o"
+  "/root/repo/lapack-netlib/SRC/zporfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zporfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zposv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zposv.f.o"
+  "/root/repo/lapack-netlib/SRC/zposvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zposvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zpotrf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotrf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zpotri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotri.f.o"
+  "/root/repo/lapack-netlib/SRC/zpotrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zppcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zppequ.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppequ.f.o"
+  "/root/repo/lapack-netlib/SRC/zpprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zppsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zppsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zpptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zpptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptri.f.o"
+  "/root/repo/lapack-netlib/SRC/zpptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zpstf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpstf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zpstrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpstrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zptcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zpteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zptrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zptsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zptsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zpttrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpttrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zpttrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpttrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zptts2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptts2.f.o"
+  "/root/repo/lapack-netlib/SRC/zrot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zrot.f.o"
+  "/root/repo/lapack-netlib/SRC/zspcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspcon.f.o"
+  "/root/repo/lapack-netlib/SRC/zsprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zspsv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspsv.f.o"
+  "/root/repo/lapack-netlib/SRC/zspsvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspsvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zsptrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zsptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptri.f.o"
+  "/root/repo/lapack-netlib/SRC/zsptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zstedc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstedc.f.o"
+  "/root/repo/lapack-netlib/SRC/zstegr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstegr.f.o"
+  "/root/repo/lapack-netlib/SRC/zstein.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstein.f.o"
+  "/root/repo/lapack-netlib/SRC/zstemr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstemr.f.o"
+  "/root/repo/lapack-netlib/SRC/zsteqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsteqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zsycon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon.f.o"
+  "/root/repo/lapack-netlib/SRC/zsycon_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zsycon_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyconv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconv.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyconvf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconvf.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyconvf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconvf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyequb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyequb.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysv.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysv_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysv_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysv_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysv_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsysvx.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysvx.f.o"
+  "/root/repo/lapack-netlib/SRC/zsyswapr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyswapr.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytf2_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytf2_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrf_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrf_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrf_rk.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_rk.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrf_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri2.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri2x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri2x.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri_3x.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_3x.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytri_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs2.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs_3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_3.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs_aa.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_aa.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs_aa_2stage.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_aa_2stage.f.o"
+  "/root/repo/lapack-netlib/SRC/zsytrs_rook.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_rook.f.o"
+  "/root/repo/lapack-netlib/SRC/ztbcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ztbrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztbtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztfsm.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfsm.f.o"
+  "/root/repo/lapack-netlib/SRC/ztftri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztftri.f.o"
+  "/root/repo/lapack-netlib/SRC/ztfttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfttp.f.o"
+  "/root/repo/lapack-netlib/SRC/ztfttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfttr.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgevc.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgex2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgex2.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgexc.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsen.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgsja.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsja.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsna.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgsy2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsy2.f.o"
+  "/root/repo/lapack-netlib/SRC/ztgsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ztplqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztplqt.f.o"
+  "/root/repo/lapack-netlib/SRC/ztplqt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztplqt2.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpmlqt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpmlqt.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpmqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpmqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpqrt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpqrt.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpqrt2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpqrt2.f.o"
+  "/root/repo/lapack-netlib/SRC/ztprfb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztprfb.f.o"
+  "/root/repo/lapack-netlib/SRC/ztprfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztprfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztptri.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztptri.f.o"
+  "/root/repo/lapack-netlib/SRC/ztptrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztptrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpttf.f.o"
+  "/root/repo/lapack-netlib/SRC/ztpttr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpttr.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrcon.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrcon.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrevc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrevc.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrevc3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrevc3.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrexc.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrexc.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrrfs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrrfs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrsen.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsen.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrsna.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsna.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrsyl.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsyl.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrtrs.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrtrs.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrttf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrttf.f.o"
+  "/root/repo/lapack-netlib/SRC/ztrttp.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrttp.f.o"
+  "/root/repo/lapack-netlib/SRC/ztzrzf.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztzrzf.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb1.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb2.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb3.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb4.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb4.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb5.f.o"
+  "/root/repo/lapack-netlib/SRC/zunbdb6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb6.f.o"
+  "/root/repo/lapack-netlib/SRC/zuncsd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zuncsd.f.o"
+  "/root/repo/lapack-netlib/SRC/zuncsd2by1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zuncsd2by1.f.o"
+  "/root/repo/lapack-netlib/SRC/zung2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zung2l.f.o"
+  "/root/repo/lapack-netlib/SRC/zung2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zung2r.f.o"
+  "/root/repo/lapack-netlib/SRC/zungbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungbr.f.o"
+  "/root/repo/lapack-netlib/SRC/zunghr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunghr.f.o"
+  "/root/repo/lapack-netlib/SRC/zungl2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungl2.f.o"
+  "/root/repo/lapack-netlib/SRC/zunglq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunglq.f.o"
+  "/root/repo/lapack-netlib/SRC/zungql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungql.f.o"
+  "/root/repo/lapack-netlib/SRC/zungqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zungr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungr2.f.o"
+  "/root/repo/lapack-netlib/SRC/zungrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungrq.f.o"
+  "/root/repo/lapack-netlib/SRC/zungtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtr.f.o"
+  "/root/repo/lapack-netlib/SRC/zungtsqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtsqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zungtsqr_row.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtsqr_row.f.o"
+  "/root/repo/lapack-netlib/SRC/zunhr_col.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunhr_col.f.o"
+  "/root/repo/lapack-netlib/SRC/zunm22.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm22.f.o"
+  "/root/repo/lapack-netlib/SRC/zunm2l.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm2l.f.o"
+  "/root/repo/lapack-netlib/SRC/zunm2r.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm2r.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmbr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmbr.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmhr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmhr.f.o"
+  "/root/repo/lapack-netlib/SRC/zunml2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunml2.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmlq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmlq.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmql.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmql.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmqr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmqr.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmr2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmr2.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmr3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmr3.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmrq.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmrq.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmrz.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmrz.f.o"
+  "/root/repo/lapack-netlib/SRC/zunmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmtr.f.o"
+  "/root/repo/lapack-netlib/SRC/zupgtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zupgtr.f.o"
+  "/root/repo/lapack-netlib/SRC/zupmtr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zupmtr.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clagge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clagge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/claghe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/claghe.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clagsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clagsy.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clahilb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clahilb.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clakf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clakf2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clarge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clarnd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarnd.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/claror.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/claror.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clarot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarot.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatm1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm1.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatm2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatm3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm3.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatm5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm5.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatm6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm6.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatme.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatme.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatmr.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatms.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatms.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/clatmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatmt.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlagge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlagge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlagsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlagsy.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlahilb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlahilb.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlakf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlakf2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlaran.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlaran.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlarge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlarnd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarnd.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlaror.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlaror.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlarot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarot.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm1.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm3.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm5.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm6.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatm7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm7.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatme.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatme.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatmr.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatms.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatms.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/dlatmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatmt.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slagge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slagge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slagsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slagsy.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slahilb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slahilb.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slakf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slakf2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slaran.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slaran.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slarge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slarnd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarnd.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slaror.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slaror.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slarot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarot.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm1.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm3.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm5.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm6.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatm7.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm7.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatme.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatme.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatmr.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatms.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatms.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/slatmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatmt.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlagge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlagge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlaghe.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlaghe.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlagsy.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlagsy.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlahilb.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlahilb.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlakf2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlakf2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlarge.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarge.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlarnd.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarnd.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlaror.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlaror.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlarot.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarot.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatm1.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm1.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatm2.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm2.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatm3.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm3.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatm5.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm5.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatm6.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm6.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatme.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatme.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatmr.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatmr.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatms.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatms.f.o"
+  "/root/repo/lapack-netlib/TESTING/MATGEN/zlatmt.f" "/root/repo/_smp_build/CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatmt.f.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  "/root/repo/lapack-netlib/LAPACKE/include"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,1934 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/dlamch.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/dsecnd_NONE.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/ilaver.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/second_NONE.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/INSTALL/slamch.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgegs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgelsx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cgeqpf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cggsvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/cggsvp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/clahrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/clatzm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/ctzrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgegs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgelsx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dgeqpf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dggsvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dggsvp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dlahrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dlatzm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/dtzrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgegs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgelsx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sgeqpf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sggsvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/sggsvp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/slahrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/slatzm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/stzrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgegs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgelsx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zgeqpf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zggsvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zggsvp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zlahrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/zlatzm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/DEPRECATED/ztzrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cbbcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cbdsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbbrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgebrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgecon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgees.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgehd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgehrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgejsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelqt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelss.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgelsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgemqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeql2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqlf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqr2p.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrfp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgeqrt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgerqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesdd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetsls.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgetsqrhrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggbak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggbal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgges.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgges3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggev3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggglm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgghd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgghrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgglse.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggsvd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cggsvp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgsvj0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgsvj1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cgtts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chb2st_kernels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chbtrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/checon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevr_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegv_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chegvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cherfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cheswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_hb2st.F.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrd_he2hb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chetrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chfrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chgeqz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chla_transtype.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chpsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chsein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/chseqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clabrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacn2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacpy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacrm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clacrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cladiv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claed8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claesy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claev2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clag2z.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clags2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clagtm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahef_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clahr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claic1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clals0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clalsa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clalsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clamswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clamtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clangb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clange.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clangt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanhs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clanht.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clansy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clantr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapll.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clapmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqgb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqhp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqr5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claqsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clar1v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clar2v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarcm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfb_gett.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarft.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarfy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clargv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarnv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarrv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clartg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clartv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarzb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clarzt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clascl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claset.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/classq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clasyf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatbs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatdf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/clatsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claunhr_col_getrfnp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/claunhr_col_getrfnp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbstf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpftrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpocon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpoequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpoequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cporfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cposv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cposvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpotrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cppsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpstf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpstrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cpttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cptts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/crot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cspsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csrscl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstedc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstegr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cstemr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csycon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconvf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyconvf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csysvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csyswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/csytrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfsm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctfttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgex2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsja.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctgsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctplqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctplqt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpmlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpmqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctprfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctpttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrevc3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctrttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ctzrzf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunbdb6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cuncsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cuncsd2by1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cung2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cung2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunghr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungl2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunglq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cungtsqr_row.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunhr_col.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm22.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunm2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmhr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunml2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cunmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cupgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/cupmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbbcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsdc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dbdsvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dcombssq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ddisna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbbrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgebrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgecon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgees.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgehd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgehrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgejsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelqt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelss.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgelsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgemqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeql2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqlf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqr2p.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrfp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgeqrt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgerqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesdd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetsls.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgetsqrhrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggbak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggbal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgges.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgges3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggev3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggglm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgghd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgghrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgglse.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggsvd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dggsvp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgsvj0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgsvj1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dgtts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhgeqz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhsein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dhseqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/disnan.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlabad.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlabrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacn2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlacpy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dladiv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlae2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaebz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaed9.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaeda.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaev2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlag2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlag2s.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlags2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagtf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagtm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagts.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlagv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlahqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlahr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaic1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaisnan.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaln2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlals0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlalsa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlalsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamrg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlamtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaneg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlangb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlange.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlangt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanhs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlansy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlantr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlanv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaorhr_col_getrfnp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaorhr_col_getrfnp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapll.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlapy3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqgb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqr5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaqtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlar1v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlar2v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfb_gett.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarft.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarfy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlargv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarnv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarra.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarre.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarrv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartgs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlartv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaruv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarzb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlarzt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlas2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlascl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasd8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasda.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasdt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaset.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasq6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlassq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlaswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlasyf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlat2s.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatbs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatdf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dlatsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dopgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dopmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorbdb6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorcsd2by1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorg2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorg2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorghr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgl2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorglq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorgtsqr_row.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorhr_col.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm22.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorm2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormhr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dorml2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dormtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbstf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpftrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpocon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpoequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpoequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dporfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dposv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dposvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpotrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dppsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpstf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpstrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dpttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dptts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/drscl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsb2st_kernels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsbtrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsfrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dspsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstebz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstedc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstegr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstemr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsterf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dstevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsycon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconvf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyconvf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevr_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygv_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsygvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsysvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsyswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_sb2st.F.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrd_sy2sb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dsytrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfsm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtfttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgex2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsja.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtgsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtplqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtplqt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpmlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpmqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtprfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtpttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrevc3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtrttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dtzrzf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/dzsum1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/icmax1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ieeeck.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaclc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaclr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladiag.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladlc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iladlr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaenv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaenv2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaprec.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaslc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilaslr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilatrans.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilauplo.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilazlc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ilazlr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iparam2stage.F.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/iparmq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/izmax1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/lsamen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbbcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsdc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sbdsvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/scombssq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/scsum1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sdisna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbbrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgebrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgecon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgees.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgehd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgehrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgejsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelqt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelss.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgelsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgemqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeql2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqlf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqr2p.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrfp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgeqrt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgerqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesdd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetsls.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgetsqrhrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggbak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggbal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgges.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgges3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggev3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggglm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgghd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgghrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgglse.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggsvd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sggsvp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgsvj0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgsvj1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sgtts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shgeqz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shsein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/shseqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sisnan.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slabad.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slabrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacn2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slacpy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sladiv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slae2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaebz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaed9.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaeda.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaev2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slag2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slag2d.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slags2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagtf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagtm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagts.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slagv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slahqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slahr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaic1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaisnan.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaln2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slals0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slalsa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slalsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamrg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slamtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaneg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slangb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slange.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slangt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanhs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slansy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slantr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slanv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaorhr_col_getrfnp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaorhr_col_getrfnp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapll.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slapy3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqgb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqr5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaqtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slar1v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slar2v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfb_gett.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarft.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarfy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slargv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarnv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarra.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarre.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarrv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartgs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slartv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaruv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarzb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slarzt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slas2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slascl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasd8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasda.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasdt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaset.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasq6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slassq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasv2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slaswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slasyf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatbs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatdf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/slatsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sopgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sopmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorbdb6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorcsd2by1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorg2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorg2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorghr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgl2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorglq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorgtsqr_row.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorhr_col.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm22.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorm2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormhr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sorml2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sormtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbstf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spftrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spocon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spoequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spoequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sporfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sposv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sposvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spotrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sppsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spstf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spstrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/spttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sptts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/srscl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssb2st_kernels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssbtrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssfrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sspsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstebz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstedc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstegr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstemr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssterf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/sstevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssycon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconvf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyconvf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevr_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygv_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssygvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssysvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssyswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_sb2st.F.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrd_sy2sb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ssytrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfsm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stfttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgex2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsja.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stgsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stplqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stplqt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpmlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpmqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stprfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stpttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strevc3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/strttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/stzrzf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/xerbla_array.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zbbcsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zbdsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zcgesv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zcposv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zdrscl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbbrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgebrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgecon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgees.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgehd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgehrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgejsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelqt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelss.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgelsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgemqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeql2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqlf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqr2p.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrfp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgeqrt3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerq2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgerqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesdd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvdq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvdx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvj.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetc2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetsls.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgetsqrhrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggbak.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggbal.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgges.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgges3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggesx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggev3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggglm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgghd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgghrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgglse.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggqrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggrqf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggsvd3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zggsvp3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgsvj0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgsvj1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zgtts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhb2st_kernels.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhbtrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhecon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheev_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevr_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheevx_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegv_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhegvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zherfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhesvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zheswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetd2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_hb2st.F.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrd_he2hb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhetrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhfrk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhgeqz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpev.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpevd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpevx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgst.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgvd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpgvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhpsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhsein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zhseqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlabrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacgv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacn2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacpy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacrm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlacrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zladiv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaed8.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaesy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaev2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlag2c.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlags2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlagtm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahef_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlahr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaic1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlals0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlalsa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlalsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlamswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlamtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlangb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlange.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlangt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanhs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlanht.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlansy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlantr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapll.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlapmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqgb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqhp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr0.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqr5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaqsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlar1v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlar2v.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarcm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfb_gett.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfgp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarft.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarfy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlargv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarnv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarrv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlartg.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlartv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarzb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlarzt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlascl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaset.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlassq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaswlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlasyf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlat2c.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatbs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatdf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatps.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlatsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaunhr_col_getrfnp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zlaunhr_col_getrfnp2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbstf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpftrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpocon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpoequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpoequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zporfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zposv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zposvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotrf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpotrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppequ.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zppsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpstf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpstrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpttrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zpttrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zptts2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zrot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspsv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zspsvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstedc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstegr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstein.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zstemr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsteqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsycon_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconvf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyconvf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyequb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysv_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsysvx.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsyswapr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytf2_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_rk.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrf_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri2x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_3x.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytri_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_aa.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_aa_2stage.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zsytrs_rook.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztbtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfsm.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztftri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztfttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgex2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsja.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsy2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztgsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztplqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztplqt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpmlqt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpmqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpqrt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpqrt2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztprfb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztprfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztptri.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztptrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztpttr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrcon.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrevc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrevc3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrexc.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrrfs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsen.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsna.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrsyl.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrtrs.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrttf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztrttp.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/ztzrzf.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb4.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunbdb6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zuncsd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zuncsd2by1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zung2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zung2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunghr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungl2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunglq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtsqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zungtsqr_row.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunhr_col.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm22.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm2l.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunm2r.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmbr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmhr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunml2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmlq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmql.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmqr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmr2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmr3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmrq.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmrz.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zunmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zupgtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/SRC/zupmtr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clagge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/claghe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clagsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clahilb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clakf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarnd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/claror.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clarot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatm6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatme.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatms.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/clatmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlagge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlagsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlahilb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlakf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlaran.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarnd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlaror.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlarot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatm7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatme.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatms.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/dlatmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slagge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slagsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slahilb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slakf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slaran.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarnd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slaror.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slarot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatm7.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatme.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatms.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/slatmt.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlagge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlaghe.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlagsy.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlahilb.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlakf2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarge.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarnd.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlaror.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlarot.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm1.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm2.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm3.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm5.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatm6.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatme.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatmr.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatms.f.o"
+  "CMakeFiles/LAPACK_OVERRIDES.dir/lapack-netlib/TESTING/MATGEN/zlatmt.f.o"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/LAPACK_OVERRIDES.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2793 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "config.h.tmp"
+  "/root/repo/cmake/OpenBLASConfig.cmake.in"
+  "/root/repo/cmake/arch.cmake"
+  "/root/repo/cmake/cc.cmake"
+  "/root/repo/cmake/f_check.cmake"
+  "/root/repo/cmake/fc.cmake"
+  "/root/repo/cmake/kernel.cmake"
+  "/root/repo/cmake/lapack.cmake"
+  "/root/repo/cmake/lapacke.cmake"
+  "/root/repo/cmake/openblas.pc.in"
+  "/root/repo/cmake/os.cmake"
+  "/root/repo/cmake/prebuild.cmake"
+  "/root/repo/cmake/system.cmake"
+  "/root/repo/cmake/system_check.cmake"
+  "/root/repo/cmake/utils.cmake"
+  "/root/repo/cpuid.S"
+  "/root/repo/ctest/CMakeLists.txt"
+  "/root/repo/driver/level2/CMakeLists.txt"
+  "/root/repo/driver/level3/CMakeLists.txt"
+  "/root/repo/driver/others/CMakeLists.txt"
+  "/root/repo/getarch.c"
+  "/root/repo/getarch_2nd.c"
+  "/root/repo/interface/CMakeLists.txt"
+  "/root/repo/kernel/CMakeLists.txt"
+  "/root/repo/lapack-netlib/TESTING/CMakeLists.txt"
+  "/root/repo/lapack-netlib/TESTING/EIG/CMakeLists.txt"
+  "/root/repo/lapack-netlib/TESTING/LIN/CMakeLists.txt"
+  "/root/repo/lapack/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/utest/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "getarch_build/config.h"
+  "getarch2_build/config.h"
+  "config.h"
+  "openblas.pc"
+  "OpenBLASConfig.cmake"
+  "OpenBLASConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "interface/CMakeFiles/scopy.c"
+  "interface/CMakeFiles/snrm2.c"
+  "interface/CMakeFiles/dcopy.c"
+  "interface/CMakeFiles/dnrm2.c"
+  "interface/CMakeFiles/ccopy.c"
+  "interface/CMakeFiles/cnrm2.c"
+  "interface/CMakeFiles/zcopy.c"
+  "interface/CMakeFiles/znrm2.c"
+  "interface/CMakeFiles/srotm.c"
+  "interface/CMakeFiles/srotmg.c"
+  "interface/CMakeFiles/srot.c"
+  "interface/CMakeFiles/sasum.c"
+  "interface/CMakeFiles/ssum.c"
+  "interface/CMakeFiles/sdot2.c"
+  "interface/CMakeFiles/ssum2.c"
+  "interface/CMakeFiles/drotm.c"
+  "interface/CMakeFiles/drotmg.c"
+  "interface/CMakeFiles/drot.c"
+  "interface/CMakeFiles/dasum.c"
+  "interface/CMakeFiles/dsum.c"
+  "interface/CMakeFiles/ddot2.c"
+  "interface/CMakeFiles/dsum2.c"
+  "interface/CMakeFiles/saxpy.c"
+  "interface/CMakeFiles/sswap.c"
+  "interface/CMakeFiles/sscal.c"
+  "interface/CMakeFiles/sdot.c"
+  "interface/CMakeFiles/srotg.c"
+  "interface/CMakeFiles/saxpby.c"
+  "interface/CMakeFiles/daxpy.c"
+  "interface/CMakeFiles/dswap.c"
+  "interface/CMakeFiles/dscal.c"
+  "interface/CMakeFiles/ddot.c"
+  "interface/CMakeFiles/drotg.c"
+  "interface/CMakeFiles/daxpby.c"
+  "interface/CMakeFiles/caxpy.c"
+  "interface/CMakeFiles/cswap.c"
+  "interface/CMakeFiles/cscal.c"
+  "interface/CMakeFiles/cdot.c"
+  "interface/CMakeFiles/crotg.c"
+  "interface/CMakeFiles/caxpby.c"
+  "interface/CMakeFiles/zaxpy.c"
+  "interface/CMakeFiles/zswap.c"
+  "interface/CMakeFiles/zscal.c"
+  "interface/CMakeFiles/zdot.c"
+  "interface/CMakeFiles/zrotg.c"
+  "interface/CMakeFiles/zaxpby.c"
+  "interface/CMakeFiles/sgemv.c"
+  "interface/CMakeFiles/sger.c"
+  "interface/CMakeFiles/strsv.c"
+  "interface/CMakeFiles/strmv.c"
+  "interface/CMakeFiles/ssyr2.c"
+  "interface/CMakeFiles/sgbmv.c"
+  "interface/CMakeFiles/ssbmv.c"
+  "interface/CMakeFiles/sspr2.c"
+  "interface/CMakeFiles/stbsv.c"
+  "interface/CMakeFiles/stbmv.c"
+  "interface/CMakeFiles/stpsv.c"
+  "interface/CMakeFiles/stpmv.c"
+  "interface/CMakeFiles/dgemv.c"
+  "interface/CMakeFiles/dger.c"
+  "interface/CMakeFiles/dtrsv.c"
+  "interface/CMakeFiles/dtrmv.c"
+  "interface/CMakeFiles/dsyr2.c"
+  "interface/CMakeFiles/dgbmv.c"
+  "interface/CMakeFiles/dsbmv.c"
+  "interface/CMakeFiles/dspr2.c"
+  "interface/CMakeFiles/dtbsv.c"
+  "interface/CMakeFiles/dtbmv.c"
+  "interface/CMakeFiles/dtpsv.c"
+  "interface/CMakeFiles/dtpmv.c"
+  "interface/CMakeFiles/cgemv.c"
+  "interface/CMakeFiles/cger.c"
+  "interface/CMakeFiles/ctrsv.c"
+  "interface/CMakeFiles/ctrmv.c"
+  "interface/CMakeFiles/csyr2.c"
+  "interface/CMakeFiles/cgbmv.c"
+  "interface/CMakeFiles/csbmv.c"
+  "interface/CMakeFiles/cspr2.c"
+  "interface/CMakeFiles/ctbsv.c"
+  "interface/CMakeFiles/ctbmv.c"
+  "interface/CMakeFiles/ctpsv.c"
+  "interface/CMakeFiles/ctpmv.c"
+  "interface/CMakeFiles/zgemv.c"
+  "interface/CMakeFiles/zger.c"
+  "interface/CMakeFiles/ztrsv.c"
+  "interface/CMakeFiles/ztrmv.c"
+  "interface/CMakeFiles/zsyr2.c"
+  "interface/CMakeFiles/zgbmv.c"
+  "interface/CMakeFiles/zsbmv.c"
+  "interface/CMakeFiles/zspr2.c"
+  "interface/CMakeFiles/ztbsv.c"
+  "interface/CMakeFiles/ztbmv.c"
+  "interface/CMakeFiles/ztpsv.c"
+  "interface/CMakeFiles/ztpmv.c"
+  "interface/CMakeFiles/ssymv.c"
+  "interface/CMakeFiles/ssyr.c"
+  "interface/CMakeFiles/sspmv.c"
+  "interface/CMakeFiles/sspr.c"
+  "interface/CMakeFiles/ssyr2v.c"
+  "interface/CMakeFiles/sgemvm.c"
+  "interface/CMakeFiles/sgemv2.c"
+  "interface/CMakeFiles/dsymv.c"
+  "interface/CMakeFiles/dsyr.c"
+  "interface/CMakeFiles/dspmv.c"
+  "interface/CMakeFiles/dspr.c"
+  "interface/CMakeFiles/dsyr2v.c"
+  "interface/CMakeFiles/dgemvm.c"
+  "interface/CMakeFiles/dgemv2.c"
+  "interface/CMakeFiles/ssymv.c"
+  "interface/CMakeFiles/ssyr.c"
+  "interface/CMakeFiles/sspmv.c"
+  "interface/CMakeFiles/sspr.c"
+  "interface/CMakeFiles/dsymv.c"
+  "interface/CMakeFiles/dsyr.c"
+  "interface/CMakeFiles/dspmv.c"
+  "interface/CMakeFiles/dspr.c"
+  "interface/CMakeFiles/csymv.c"
+  "interface/CMakeFiles/csyr.c"
+  "interface/CMakeFiles/cspmv.c"
+  "interface/CMakeFiles/cspr.c"
+  "interface/CMakeFiles/zsymv.c"
+  "interface/CMakeFiles/zsyr.c"
+  "interface/CMakeFiles/zspmv.c"
+  "interface/CMakeFiles/zspr.c"
+  "interface/CMakeFiles/chemv.c"
+  "interface/CMakeFiles/chbmv.c"
+  "interface/CMakeFiles/cher.c"
+  "interface/CMakeFiles/cher2.c"
+  "interface/CMakeFiles/chpmv.c"
+  "interface/CMakeFiles/chpr.c"
+  "interface/CMakeFiles/chpr2.c"
+  "interface/CMakeFiles/zhemv.c"
+  "interface/CMakeFiles/zhbmv.c"
+  "interface/CMakeFiles/zher.c"
+  "interface/CMakeFiles/zher2.c"
+  "interface/CMakeFiles/zhpmv.c"
+  "interface/CMakeFiles/zhpr.c"
+  "interface/CMakeFiles/zhpr2.c"
+  "interface/CMakeFiles/sgemm.c"
+  "interface/CMakeFiles/ssymm.c"
+  "interface/CMakeFiles/strsm.c"
+  "interface/CMakeFiles/ssyrk.c"
+  "interface/CMakeFiles/ssyr2k.c"
+  "interface/CMakeFiles/dgemm.c"
+  "interface/CMakeFiles/dsymm.c"
+  "interface/CMakeFiles/dtrsm.c"
+  "interface/CMakeFiles/dsyrk.c"
+  "interface/CMakeFiles/dsyr2k.c"
+  "interface/CMakeFiles/cgemm.c"
+  "interface/CMakeFiles/csymm.c"
+  "interface/CMakeFiles/ctrsm.c"
+  "interface/CMakeFiles/csyrk.c"
+  "interface/CMakeFiles/csyr2k.c"
+  "interface/CMakeFiles/zgemm.c"
+  "interface/CMakeFiles/zsymm.c"
+  "interface/CMakeFiles/ztrsm.c"
+  "interface/CMakeFiles/zsyrk.c"
+  "interface/CMakeFiles/zsyr2k.c"
+  "interface/CMakeFiles/somatcopy.c"
+  "interface/CMakeFiles/simatcopy.c"
+  "interface/CMakeFiles/sgeadd.c"
+  "interface/CMakeFiles/domatcopy.c"
+  "interface/CMakeFiles/dimatcopy.c"
+  "interface/CMakeFiles/dgeadd.c"
+  "interface/CMakeFiles/comatcopy.c"
+  "interface/CMakeFiles/cimatcopy.c"
+  "interface/CMakeFiles/cgeadd.c"
+  "interface/CMakeFiles/zomatcopy.c"
+  "interface/CMakeFiles/zimatcopy.c"
+  "interface/CMakeFiles/zgeadd.c"
+  "interface/CMakeFiles/xerbla.c"
+  "interface/CMakeFiles/sdsdot.c"
+  "interface/CMakeFiles/dsdot.c"
+  "interface/CMakeFiles/strmm.c"
+  "interface/CMakeFiles/dtrmm.c"
+  "interface/CMakeFiles/ctrmm.c"
+  "interface/CMakeFiles/ztrmm.c"
+  "interface/CMakeFiles/smax.c"
+  "interface/CMakeFiles/dmax.c"
+  "interface/CMakeFiles/cmax.c"
+  "interface/CMakeFiles/zmax.c"
+  "interface/CMakeFiles/samax.c"
+  "interface/CMakeFiles/damax.c"
+  "interface/CMakeFiles/camax.c"
+  "interface/CMakeFiles/zamax.c"
+  "interface/CMakeFiles/samin.c"
+  "interface/CMakeFiles/damin.c"
+  "interface/CMakeFiles/camin.c"
+  "interface/CMakeFiles/zamin.c"
+  "interface/CMakeFiles/smin.c"
+  "interface/CMakeFiles/dmin.c"
+  "interface/CMakeFiles/cmin.c"
+  "interface/CMakeFiles/zmin.c"
+  "interface/CMakeFiles/ismax.c"
+  "interface/CMakeFiles/idmax.c"
+  "interface/CMakeFiles/icmax.c"
+  "interface/CMakeFiles/izmax.c"
+  "interface/CMakeFiles/isamax.c"
+  "interface/CMakeFiles/idamax.c"
+  "interface/CMakeFiles/icamax.c"
+  "interface/CMakeFiles/izamax.c"
+  "interface/CMakeFiles/isamin.c"
+  "interface/CMakeFiles/idamin.c"
+  "interface/CMakeFiles/icamin.c"
+  "interface/CMakeFiles/izamin.c"
+  "interface/CMakeFiles/ismin.c"
+  "interface/CMakeFiles/idmin.c"
+  "interface/CMakeFiles/icmin.c"
+  "interface/CMakeFiles/izmin.c"
+  "interface/CMakeFiles/sbdot.c"
+  "interface/CMakeFiles/sbgemm.c"
+  "interface/CMakeFiles/sbgemv.c"
+  "interface/CMakeFiles/sbstobf16.c"
+  "interface/CMakeFiles/sbdtobf16.c"
+  "interface/CMakeFiles/sbf16tos.c"
+  "interface/CMakeFiles/dbf16tod.c"
+  "interface/CMakeFiles/cgeru.c"
+  "interface/CMakeFiles/cgerc.c"
+  "interface/CMakeFiles/cdotc.c"
+  "interface/CMakeFiles/cdotu.c"
+  "interface/CMakeFiles/chemm.c"
+  "interface/CMakeFiles/cherk.c"
+  "interface/CMakeFiles/cher2k.c"
+  "interface/CMakeFiles/cgemm3m.c"
+  "interface/CMakeFiles/csscal.c"
+  "interface/CMakeFiles/scnrm2.c"
+  "interface/CMakeFiles/csrot.c"
+  "interface/CMakeFiles/scamin.c"
+  "interface/CMakeFiles/scamax.c"
+  "interface/CMakeFiles/scasum.c"
+  "interface/CMakeFiles/scsum.c"
+  "interface/CMakeFiles/zgeru.c"
+  "interface/CMakeFiles/zgerc.c"
+  "interface/CMakeFiles/zdotc.c"
+  "interface/CMakeFiles/zdotu.c"
+  "interface/CMakeFiles/zhemm.c"
+  "interface/CMakeFiles/zherk.c"
+  "interface/CMakeFiles/zher2k.c"
+  "interface/CMakeFiles/zgemm3m.c"
+  "interface/CMakeFiles/zdscal.c"
+  "interface/CMakeFiles/dznrm2.c"
+  "interface/CMakeFiles/zdrot.c"
+  "interface/CMakeFiles/dzamin.c"
+  "interface/CMakeFiles/dzamax.c"
+  "interface/CMakeFiles/dzasum.c"
+  "interface/CMakeFiles/dzsum.c"
+  "interface/CMakeFiles/cblas_scopy.c"
+  "interface/CMakeFiles/cblas_snrm2.c"
+  "interface/CMakeFiles/cblas_dcopy.c"
+  "interface/CMakeFiles/cblas_dnrm2.c"
+  "interface/CMakeFiles/cblas_ccopy.c"
+  "interface/CMakeFiles/cblas_cnrm2.c"
+  "interface/CMakeFiles/cblas_zcopy.c"
+  "interface/CMakeFiles/cblas_znrm2.c"
+  "interface/CMakeFiles/cblas_srotm.c"
+  "interface/CMakeFiles/cblas_srotmg.c"
+  "interface/CMakeFiles/cblas_srot.c"
+  "interface/CMakeFiles/cblas_sasum.c"
+  "interface/CMakeFiles/cblas_ssum.c"
+  "interface/CMakeFiles/cblas_sdot2.c"
+  "interface/CMakeFiles/cblas_ssum2.c"
+  "interface/CMakeFiles/cblas_drotm.c"
+  "interface/CMakeFiles/cblas_drotmg.c"
+  "interface/CMakeFiles/cblas_drot.c"
+  "interface/CMakeFiles/cblas_dasum.c"
+  "interface/CMakeFiles/cblas_dsum.c"
+  "interface/CMakeFiles/cblas_ddot2.c"
+  "interface/CMakeFiles/cblas_dsum2.c"
+  "interface/CMakeFiles/cblas_saxpy.c"
+  "interface/CMakeFiles/cblas_sswap.c"
+  "interface/CMakeFiles/cblas_sscal.c"
+  "interface/CMakeFiles/cblas_sdot.c"
+  "interface/CMakeFiles/cblas_srotg.c"
+  "interface/CMakeFiles/cblas_saxpby.c"
+  "interface/CMakeFiles/cblas_daxpy.c"
+  "interface/CMakeFiles/cblas_dswap.c"
+  "interface/CMakeFiles/cblas_dscal.c"
+  "interface/CMakeFiles/cblas_ddot.c"
+  "interface/CMakeFiles/cblas_drotg.c"
+  "interface/CMakeFiles/cblas_daxpby.c"
+  "interface/CMakeFiles/cblas_caxpy.c"
+  "interface/CMakeFiles/cblas_cswap.c"
+  "interface/CMakeFiles/cblas_cscal.c"
+  "interface/CMakeFiles/cblas_cdot.c"
+  "interface/CMakeFiles/cblas_crotg.c"
+  "interface/CMakeFiles/cblas_caxpby.c"
+  "interface/CMakeFiles/cblas_zaxpy.c"
+  "interface/CMakeFiles/cblas_zswap.c"
+  "interface/CMakeFiles/cblas_zscal.c"
+  "interface/CMakeFiles/cblas_zdot.c"
+  "interface/CMakeFiles/cblas_zrotg.c"
+  "interface/CMakeFiles/cblas_zaxpby.c"
+  "interface/CMakeFiles/cblas_sgemv.c"
+  "interface/CMakeFiles/cblas_sger.c"
+  "interface/CMakeFiles/cblas_strsv.c"
+  "interface/CMakeFiles/cblas_strmv.c"
+  "interface/CMakeFiles/cblas_ssyr2.c"
+  "interface/CMakeFiles/cblas_sgbmv.c"
+  "interface/CMakeFiles/cblas_ssbmv.c"
+  "interface/CMakeFiles/cblas_sspr2.c"
+  "interface/CMakeFiles/cblas_stbsv.c"
+  "interface/CMakeFiles/cblas_stbmv.c"
+  "interface/CMakeFiles/cblas_stpsv.c"
+  "interface/CMakeFiles/cblas_stpmv.c"
+  "interface/CMakeFiles/cblas_dgemv.c"
+  "interface/CMakeFiles/cblas_dger.c"
+  "interface/CMakeFiles/cblas_dtrsv.c"
+  "interface/CMakeFiles/cblas_dtrmv.c"
+  "interface/CMakeFiles/cblas_dsyr2.c"
+  "interface/CMakeFiles/cblas_dgbmv.c"
+  "interface/CMakeFiles/cblas_dsbmv.c"
+  "interface/CMakeFiles/cblas_dspr2.c"
+  "interface/CMakeFiles/cblas_dtbsv.c"
+  "interface/CMakeFiles/cblas_dtbmv.c"
+  "interface/CMakeFiles/cblas_dtpsv.c"
+  "interface/CMakeFiles/cblas_dtpmv.c"
+  "interface/CMakeFiles/cblas_cgemv.c"
+  "interface/CMakeFiles/cblas_cger.c"
+  "interface/CMakeFiles/cblas_ctrsv.c"
+  "interface/CMakeFiles/cblas_ctrmv.c"
+  "interface/CMakeFiles/cblas_csyr2.c"
+  "interface/CMakeFiles/cblas_cgbmv.c"
+  "interface/CMakeFiles/cblas_csbmv.c"
+  "interface/CMakeFiles/cblas_cspr2.c"
+  "interface/CMakeFiles/cblas_ctbsv.c"
+  "interface/CMakeFiles/cblas_ctbmv.c"
+  "interface/CMakeFiles/cblas_ctpsv.c"
+  "interface/CMakeFiles/cblas_ctpmv.c"
+  "interface/CMakeFiles/cblas_zgemv.c"
+  "interface/CMakeFiles/cblas_zger.c"
+  "interface/CMakeFiles/cblas_ztrsv.c"
+  "interface/CMakeFiles/cblas_ztrmv.c"
+  "interface/CMakeFiles/cblas_zsyr2.c"
+  "interface/CMakeFiles/cblas_zgbmv.c"
+  "interface/CMakeFiles/cblas_zsbmv.c"
+  "interface/CMakeFiles/cblas_zspr2.c"
+  "interface/CMakeFiles/cblas_ztbsv.c"
+  "interface/CMakeFiles/cblas_ztbmv.c"
+  "interface/CMakeFiles/cblas_ztpsv.c"
+  "interface/CMakeFiles/cblas_ztpmv.c"
+  "interface/CMakeFiles/cblas_ssymv.c"
+  "interface/CMakeFiles/cblas_ssyr.c"
+  "interface/CMakeFiles/cblas_sspmv.c"
+  "interface/CMakeFiles/cblas_sspr.c"
+  "interface/CMakeFiles/cblas_ssyr2v.c"
+  "interface/CMakeFiles/cblas_sgemvm.c"
+  "interface/CMakeFiles/cblas_sgemv2.c"
+  "interface/CMakeFiles/cblas_dsymv.c"
+  "interface/CMakeFiles/cblas_dsyr.c"
+  "interface/CMakeFiles/cblas_dspmv.c"
+  "interface/CMakeFiles/cblas_dspr.c"
+  "interface/CMakeFiles/cblas_dsyr2v.c"
+  "interface/CMakeFiles/cblas_dgemvm.c"
+  "interface/CMakeFiles/cblas_dgemv2.c"
+  "interface/CMakeFiles/cblas_ssymv.c"
+  "interface/CMakeFiles/cblas_ssyr.c"
+  "interface/CMakeFiles/cblas_sspmv.c"
+  "interface/CMakeFiles/cblas_sspr.c"
+  "interface/CMakeFiles/cblas_dsymv.c"
+  "interface/CMakeFiles/cblas_dsyr.c"
+  "interface/CMakeFiles/cblas_dspmv.c"
+  "interface/CMakeFiles/cblas_dspr.c"
+  "interface/CMakeFiles/cblas_csymv.c"
+  "interface/CMakeFiles/cblas_csyr.c"
+  "interface/CMakeFiles/cblas_cspmv.c"
+  "interface/CMakeFiles/cblas_cspr.c"
+  "interface/CMakeFiles/cblas_zsymv.c"
+  "interface/CMakeFiles/cblas_zsyr.c"
+  "interface/CMakeFiles/cblas_zspmv.c"
+  "interface/CMakeFiles/cblas_zspr.c"
+  "interface/CMakeFiles/cblas_chemv.c"
+  "interface/CMakeFiles/cblas_chbmv.c"
+  "interface/CMakeFiles/cblas_cher.c"
+  "interface/CMakeFiles/cblas_cher2.c"
+  "interface/CMakeFiles/cblas_chpmv.c"
+  "interface/CMakeFiles/cblas_chpr.c"
+  "interface/CMakeFiles/cblas_chpr2.c"
+  "interface/CMakeFiles/cblas_zhemv.c"
+  "interface/CMakeFiles/cblas_zhbmv.c"
+  "interface/CMakeFiles/cblas_zher.c"
+  "interface/CMakeFiles/cblas_zher2.c"
+  "interface/CMakeFiles/cblas_zhpmv.c"
+  "interface/CMakeFiles/cblas_zhpr.c"
+  "interface/CMakeFiles/cblas_zhpr2.c"
+  "interface/CMakeFiles/cblas_sgemm.c"
+  "interface/CMakeFiles/cblas_ssymm.c"
+  "interface/CMakeFiles/cblas_strsm.c"
+  "interface/CMakeFiles/cblas_ssyrk.c"
+  "interface/CMakeFiles/cblas_ssyr2k.c"
+  "interface/CMakeFiles/cblas_dgemm.c"
+  "interface/CMakeFiles/cblas_dsymm.c"
+  "interface/CMakeFiles/cblas_dtrsm.c"
+  "interface/CMakeFiles/cblas_dsyrk.c"
+  "interface/CMakeFiles/cblas_dsyr2k.c"
+  "interface/CMakeFiles/cblas_cgemm.c"
+  "interface/CMakeFiles/cblas_csymm.c"
+  "interface/CMakeFiles/cblas_ctrsm.c"
+  "interface/CMakeFiles/cblas_csyrk.c"
+  "interface/CMakeFiles/cblas_csyr2k.c"
+  "interface/CMakeFiles/cblas_zgemm.c"
+  "interface/CMakeFiles/cblas_zsymm.c"
+  "interface/CMakeFiles/cblas_ztrsm.c"
+  "interface/CMakeFiles/cblas_zsyrk.c"
+  "interface/CMakeFiles/cblas_zsyr2k.c"
+  "interface/CMakeFiles/cblas_somatcopy.c"
+  "interface/CMakeFiles/cblas_simatcopy.c"
+  "interface/CMakeFiles/cblas_sgeadd.c"
+  "interface/CMakeFiles/cblas_domatcopy.c"
+  "interface/CMakeFiles/cblas_dimatcopy.c"
+  "interface/CMakeFiles/cblas_dgeadd.c"
+  "interface/CMakeFiles/cblas_comatcopy.c"
+  "interface/CMakeFiles/cblas_cimatcopy.c"
+  "interface/CMakeFiles/cblas_cgeadd.c"
+  "interface/CMakeFiles/cblas_zomatcopy.c"
+  "interface/CMakeFiles/cblas_zimatcopy.c"
+  "interface/CMakeFiles/cblas_zgeadd.c"
+  "interface/CMakeFiles/cblas_xerbla.c"
+  "interface/CMakeFiles/cblas_sdsdot.c"
+  "interface/CMakeFiles/cblas_dsdot.c"
+  "interface/CMakeFiles/cblas_strmm.c"
+  "interface/CMakeFiles/cblas_dtrmm.c"
+  "interface/CMakeFiles/cblas_ctrmm.c"
+  "interface/CMakeFiles/cblas_ztrmm.c"
+  "interface/CMakeFiles/cblas_smax.c"
+  "interface/CMakeFiles/cblas_dmax.c"
+  "interface/CMakeFiles/cblas_cmax.c"
+  "interface/CMakeFiles/cblas_zmax.c"
+  "interface/CMakeFiles/cblas_samax.c"
+  "interface/CMakeFiles/cblas_damax.c"
+  "interface/CMakeFiles/cblas_camax.c"
+  "interface/CMakeFiles/cblas_zamax.c"
+  "interface/CMakeFiles/cblas_samin.c"
+  "interface/CMakeFiles/cblas_damin.c"
+  "interface/CMakeFiles/cblas_camin.c"
+  "interface/CMakeFiles/cblas_zamin.c"
+  "interface/CMakeFiles/cblas_smin.c"
+  "interface/CMakeFiles/cblas_dmin.c"
+  "interface/CMakeFiles/cblas_cmin.c"
+  "interface/CMakeFiles/cblas_zmin.c"
+  "interface/CMakeFiles/cblas_ismax.c"
+  "interface/CMakeFiles/cblas_idmax.c"
+  "interface/CMakeFiles/cblas_icmax.c"
+  "interface/CMakeFiles/cblas_izmax.c"
+  "interface/CMakeFiles/cblas_isamax.c"
+  "interface/CMakeFiles/cblas_idamax.c"
+  "interface/CMakeFiles/cblas_icamax.c"
+  "interface/CMakeFiles/cblas_izamax.c"
+  "interface/CMakeFiles/cblas_isamin.c"
+  "interface/CMakeFiles/cblas_idamin.c"
+  "interface/CMakeFiles/cblas_icamin.c"
+  "interface/CMakeFiles/cblas_izamin.c"
+  "interface/CMakeFiles/cblas_ismin.c"
+  "interface/CMakeFiles/cblas_idmin.c"
+  "interface/CMakeFiles/cblas_icmin.c"
+  "interface/CMakeFiles/cblas_izmin.c"
+  "interface/CMakeFiles/cblas_sbdot.c"
+  "interface/CMakeFiles/cblas_sbgemm.c"
+  "interface/CMakeFiles/cblas_sbgemv.c"
+  "interface/CMakeFiles/cblas_sbstobf16.c"
+  "interface/CMakeFiles/cblas_sbdtobf16.c"
+  "interface/CMakeFiles/cblas_sbf16tos.c"
+  "interface/CMakeFiles/cblas_dbf16tod.c"
+  "interface/CMakeFiles/cblas_cgeru.c"
+  "interface/CMakeFiles/cblas_cgerc.c"
+  "interface/CMakeFiles/cblas_cdotc.c"
+  "interface/CMakeFiles/cblas_cdotu.c"
+  "interface/CMakeFiles/cblas_chemm.c"
+  "interface/CMakeFiles/cblas_cherk.c"
+  "interface/CMakeFiles/cblas_cher2k.c"
+  "interface/CMakeFiles/cblas_cgemm3m.c"
+  "interface/CMakeFiles/cblas_csscal.c"
+  "interface/CMakeFiles/cblas_scnrm2.c"
+  "interface/CMakeFiles/cblas_csrot.c"
+  "interface/CMakeFiles/cblas_scamin.c"
+  "interface/CMakeFiles/cblas_scamax.c"
+  "interface/CMakeFiles/cblas_scasum.c"
+  "interface/CMakeFiles/cblas_scsum.c"
+  "interface/CMakeFiles/cblas_zgeru.c"
+  "interface/CMakeFiles/cblas_zgerc.c"
+  "interface/CMakeFiles/cblas_zdotc.c"
+  "interface/CMakeFiles/cblas_zdotu.c"
+  "interface/CMakeFiles/cblas_zhemm.c"
+  "interface/CMakeFiles/cblas_zherk.c"
+  "interface/CMakeFiles/cblas_zher2k.c"
+  "interface/CMakeFiles/cblas_zgemm3m.c"
+  "interface/CMakeFiles/cblas_zdscal.c"
+  "interface/CMakeFiles/cblas_dznrm2.c"
+  "interface/CMakeFiles/cblas_zdrot.c"
+  "interface/CMakeFiles/cblas_dzamin.c"
+  "interface/CMakeFiles/cblas_dzamax.c"
+  "interface/CMakeFiles/cblas_dzasum.c"
+  "interface/CMakeFiles/cblas_dzsum.c"
+  "interface/CMakeFiles/cblas_sgemm_batch.c"
+  "interface/CMakeFiles/cblas_sgemm_batch_strided.c"
+  "interface/CMakeFiles/cblas_sgemm_pack_get_size.c"
+  "interface/CMakeFiles/cblas_sgemm_pack.c"
+  "interface/CMakeFiles/cblas_sgemm_compute.c"
+  "interface/CMakeFiles/cblas_dgemm_batch.c"
+  "interface/CMakeFiles/cblas_dgemm_batch_strided.c"
+  "interface/CMakeFiles/cblas_dgemm_pack_get_size.c"
+  "interface/CMakeFiles/cblas_dgemm_pack.c"
+  "interface/CMakeFiles/cblas_dgemm_compute.c"
+  "interface/CMakeFiles/cblas_cgemm_batch.c"
+  "interface/CMakeFiles/cblas_cgemm_batch_strided.c"
+  "interface/CMakeFiles/cblas_cdotu_sub.c"
+  "interface/CMakeFiles/cblas_cdotc_sub.c"
+  "interface/CMakeFiles/cblas_zgemm_batch.c"
+  "interface/CMakeFiles/cblas_zgemm_batch_strided.c"
+  "interface/CMakeFiles/cblas_zdotu_sub.c"
+  "interface/CMakeFiles/cblas_zdotc_sub.c"
+  "interface/CMakeFiles/cblas_sbgemm_pack_get_size.c"
+  "interface/CMakeFiles/cblas_sbgemm_pack.c"
+  "interface/CMakeFiles/cblas_sbgemm_compute.c"
+  "interface/CMakeFiles/cblas_sbgemm_epilogue.c"
+  "interface/CMakeFiles/sgesv.c"
+  "interface/CMakeFiles/dgesv.c"
+  "interface/CMakeFiles/cgesv.c"
+  "interface/CMakeFiles/zgesv.c"
+  "interface/CMakeFiles/sgetrf.c"
+  "interface/CMakeFiles/sgetrs.c"
+  "interface/CMakeFiles/spotrf.c"
+  "interface/CMakeFiles/sgetf2.c"
+  "interface/CMakeFiles/spotf2.c"
+  "interface/CMakeFiles/slaswp.c"
+  "interface/CMakeFiles/slauu2.c"
+  "interface/CMakeFiles/slauum.c"
+  "interface/CMakeFiles/strti2.c"
+  "interface/CMakeFiles/strtri.c"
+  "interface/CMakeFiles/dgetrf.c"
+  "interface/CMakeFiles/dgetrs.c"
+  "interface/CMakeFiles/dpotrf.c"
+  "interface/CMakeFiles/dgetf2.c"
+  "interface/CMakeFiles/dpotf2.c"
+  "interface/CMakeFiles/dlaswp.c"
+  "interface/CMakeFiles/dlauu2.c"
+  "interface/CMakeFiles/dlauum.c"
+  "interface/CMakeFiles/dtrti2.c"
+  "interface/CMakeFiles/dtrtri.c"
+  "interface/CMakeFiles/cgetrf.c"
+  "interface/CMakeFiles/cgetrs.c"
+  "interface/CMakeFiles/cpotrf.c"
+  "interface/CMakeFiles/cgetf2.c"
+  "interface/CMakeFiles/cpotf2.c"
+  "interface/CMakeFiles/claswp.c"
+  "interface/CMakeFiles/clauu2.c"
+  "interface/CMakeFiles/clauum.c"
+  "interface/CMakeFiles/ctrti2.c"
+  "interface/CMakeFiles/ctrtri.c"
+  "interface/CMakeFiles/zgetrf.c"
+  "interface/CMakeFiles/zgetrs.c"
+  "interface/CMakeFiles/zpotrf.c"
+  "interface/CMakeFiles/zgetf2.c"
+  "interface/CMakeFiles/zpotf2.c"
+  "interface/CMakeFiles/zlaswp.c"
+  "interface/CMakeFiles/zlauu2.c"
+  "interface/CMakeFiles/zlauum.c"
+  "interface/CMakeFiles/ztrti2.c"
+  "interface/CMakeFiles/ztrtri.c"
+  "interface/CMakeFiles/sgeqrf.c"
+  "interface/CMakeFiles/dgeqrf.c"
+  "interface/CMakeFiles/dsgesv.c"
+  "interface/CMakeFiles/dsposv.c"
+  "interface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "driver/level2/CMakeFiles/ssbmv_U.c"
+  "driver/level2/CMakeFiles/dsbmv_U.c"
+  "driver/level2/CMakeFiles/csbmv_U.c"
+  "driver/level2/CMakeFiles/zsbmv_U.c"
+  "driver/level2/CMakeFiles/sspmv_U.c"
+  "driver/level2/CMakeFiles/dspmv_U.c"
+  "driver/level2/CMakeFiles/cspmv_U.c"
+  "driver/level2/CMakeFiles/zspmv_U.c"
+  "driver/level2/CMakeFiles/sspr_U.c"
+  "driver/level2/CMakeFiles/dspr_U.c"
+  "driver/level2/CMakeFiles/cspr_U.c"
+  "driver/level2/CMakeFiles/zspr_U.c"
+  "driver/level2/CMakeFiles/sspr2_U.c"
+  "driver/level2/CMakeFiles/dspr2_U.c"
+  "driver/level2/CMakeFiles/cspr2_U.c"
+  "driver/level2/CMakeFiles/zspr2_U.c"
+  "driver/level2/CMakeFiles/ssyr_U.c"
+  "driver/level2/CMakeFiles/dsyr_U.c"
+  "driver/level2/CMakeFiles/csyr_U.c"
+  "driver/level2/CMakeFiles/zsyr_U.c"
+  "driver/level2/CMakeFiles/ssyr2_U.c"
+  "driver/level2/CMakeFiles/dsyr2_U.c"
+  "driver/level2/CMakeFiles/csyr2_U.c"
+  "driver/level2/CMakeFiles/zsyr2_U.c"
+  "driver/level2/CMakeFiles/ssbmv_L.c"
+  "driver/level2/CMakeFiles/dsbmv_L.c"
+  "driver/level2/CMakeFiles/csbmv_L.c"
+  "driver/level2/CMakeFiles/zsbmv_L.c"
+  "driver/level2/CMakeFiles/sspmv_L.c"
+  "driver/level2/CMakeFiles/dspmv_L.c"
+  "driver/level2/CMakeFiles/cspmv_L.c"
+  "driver/level2/CMakeFiles/zspmv_L.c"
+  "driver/level2/CMakeFiles/sspr_L.c"
+  "driver/level2/CMakeFiles/dspr_L.c"
+  "driver/level2/CMakeFiles/cspr_L.c"
+  "driver/level2/CMakeFiles/zspr_L.c"
+  "driver/level2/CMakeFiles/sspr2_L.c"
+  "driver/level2/CMakeFiles/dspr2_L.c"
+  "driver/level2/CMakeFiles/cspr2_L.c"
+  "driver/level2/CMakeFiles/zspr2_L.c"
+  "driver/level2/CMakeFiles/ssyr_L.c"
+  "driver/level2/CMakeFiles/dsyr_L.c"
+  "driver/level2/CMakeFiles/csyr_L.c"
+  "driver/level2/CMakeFiles/zsyr_L.c"
+  "driver/level2/CMakeFiles/ssyr2_L.c"
+  "driver/level2/CMakeFiles/dsyr2_L.c"
+  "driver/level2/CMakeFiles/csyr2_L.c"
+  "driver/level2/CMakeFiles/zsyr2_L.c"
+  "driver/level2/CMakeFiles/sgbmv_n.c"
+  "driver/level2/CMakeFiles/dgbmv_n.c"
+  "driver/level2/CMakeFiles/cgbmv_n.c"
+  "driver/level2/CMakeFiles/zgbmv_n.c"
+  "driver/level2/CMakeFiles/sgbmv_t.c"
+  "driver/level2/CMakeFiles/dgbmv_t.c"
+  "driver/level2/CMakeFiles/cgbmv_t.c"
+  "driver/level2/CMakeFiles/zgbmv_t.c"
+  "driver/level2/CMakeFiles/cgbmv_r.c"
+  "driver/level2/CMakeFiles/zgbmv_r.c"
+  "driver/level2/CMakeFiles/cgbmv_c.c"
+  "driver/level2/CMakeFiles/zgbmv_c.c"
+  "driver/level2/CMakeFiles/cgbmv_o.c"
+  "driver/level2/CMakeFiles/zgbmv_o.c"
+  "driver/level2/CMakeFiles/cgbmv_u.c"
+  "driver/level2/CMakeFiles/zgbmv_u.c"
+  "driver/level2/CMakeFiles/cgbmv_s.c"
+  "driver/level2/CMakeFiles/zgbmv_s.c"
+  "driver/level2/CMakeFiles/cgbmv_d.c"
+  "driver/level2/CMakeFiles/zgbmv_d.c"
+  "driver/level2/CMakeFiles/sgemv_thread_n.c"
+  "driver/level2/CMakeFiles/sgemv_thread_t.c"
+  "driver/level2/CMakeFiles/sgbmv_thread_n.c"
+  "driver/level2/CMakeFiles/sgbmv_thread_t.c"
+  "driver/level2/CMakeFiles/strmv_NUN.c"
+  "driver/level2/CMakeFiles/strmv_NUU.c"
+  "driver/level2/CMakeFiles/strmv_TLN.c"
+  "driver/level2/CMakeFiles/strmv_TLU.c"
+  "driver/level2/CMakeFiles/stbmv_NUN.c"
+  "driver/level2/CMakeFiles/stbmv_NUU.c"
+  "driver/level2/CMakeFiles/stbmv_TLN.c"
+  "driver/level2/CMakeFiles/stbmv_TLU.c"
+  "driver/level2/CMakeFiles/stbsv_NUN.c"
+  "driver/level2/CMakeFiles/stbsv_NUU.c"
+  "driver/level2/CMakeFiles/stbsv_TLN.c"
+  "driver/level2/CMakeFiles/stbsv_TLU.c"
+  "driver/level2/CMakeFiles/stpmv_NUN.c"
+  "driver/level2/CMakeFiles/stpmv_NUU.c"
+  "driver/level2/CMakeFiles/stpmv_TLN.c"
+  "driver/level2/CMakeFiles/stpmv_TLU.c"
+  "driver/level2/CMakeFiles/stpsv_NUN.c"
+  "driver/level2/CMakeFiles/stpsv_NUU.c"
+  "driver/level2/CMakeFiles/stpsv_TLN.c"
+  "driver/level2/CMakeFiles/stpsv_TLU.c"
+  "driver/level2/CMakeFiles/strsv_NUN.c"
+  "driver/level2/CMakeFiles/strsv_NUU.c"
+  "driver/level2/CMakeFiles/strsv_TLN.c"
+  "driver/level2/CMakeFiles/strsv_TLU.c"
+  "driver/level2/CMakeFiles/strmv_NLN.c"
+  "driver/level2/CMakeFiles/strmv_NLU.c"
+  "driver/level2/CMakeFiles/strmv_TUN.c"
+  "driver/level2/CMakeFiles/strmv_TUU.c"
+  "driver/level2/CMakeFiles/stbmv_NLN.c"
+  "driver/level2/CMakeFiles/stbmv_NLU.c"
+  "driver/level2/CMakeFiles/stbmv_TUN.c"
+  "driver/level2/CMakeFiles/stbmv_TUU.c"
+  "driver/level2/CMakeFiles/stbsv_NLN.c"
+  "driver/level2/CMakeFiles/stbsv_NLU.c"
+  "driver/level2/CMakeFiles/stbsv_TUN.c"
+  "driver/level2/CMakeFiles/stbsv_TUU.c"
+  "driver/level2/CMakeFiles/stpmv_NLN.c"
+  "driver/level2/CMakeFiles/stpmv_NLU.c"
+  "driver/level2/CMakeFiles/stpmv_TUN.c"
+  "driver/level2/CMakeFiles/stpmv_TUU.c"
+  "driver/level2/CMakeFiles/stpsv_NLN.c"
+  "driver/level2/CMakeFiles/stpsv_NLU.c"
+  "driver/level2/CMakeFiles/stpsv_TUN.c"
+  "driver/level2/CMakeFiles/stpsv_TUU.c"
+  "driver/level2/CMakeFiles/strsv_NLN.c"
+  "driver/level2/CMakeFiles/strsv_NLU.c"
+  "driver/level2/CMakeFiles/strsv_TUN.c"
+  "driver/level2/CMakeFiles/strsv_TUU.c"
+  "driver/level2/CMakeFiles/sger_thread.c"
+  "driver/level2/CMakeFiles/ssyr2v_thread_U.c"
+  "driver/level2/CMakeFiles/ssyr2v_thread_L.c"
+  "driver/level2/CMakeFiles/sgemvm_thread_n.c"
+  "driver/level2/CMakeFiles/sgemvm_thread_t.c"
+  "driver/level2/CMakeFiles/strmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/strmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/strmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/strmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/strmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/strmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/strmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/strmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/strsv_thread_NUN.c"
+  "driver/level2/CMakeFiles/strsv_thread_NLN.c"
+  "driver/level2/CMakeFiles/strsv_thread_NUU.c"
+  "driver/level2/CMakeFiles/strsv_thread_NLU.c"
+  "driver/level2/CMakeFiles/strsv_thread_TUN.c"
+  "driver/level2/CMakeFiles/strsv_thread_TLN.c"
+  "driver/level2/CMakeFiles/strsv_thread_TUU.c"
+  "driver/level2/CMakeFiles/strsv_thread_TLU.c"
+  "driver/level2/CMakeFiles/stpmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/stpmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/stpmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/stpmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/stpmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/stpmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/stpmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/stpmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/stbmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/stbmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/stbmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/stbmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/stbmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/stbmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/stbmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/stbmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/dgemv_thread_n.c"
+  "driver/level2/CMakeFiles/dgemv_thread_t.c"
+  "driver/level2/CMakeFiles/dgbmv_thread_n.c"
+  "driver/level2/CMakeFiles/dgbmv_thread_t.c"
+  "driver/level2/CMakeFiles/dtrmv_NUN.c"
+  "driver/level2/CMakeFiles/dtrmv_NUU.c"
+  "driver/level2/CMakeFiles/dtrmv_TLN.c"
+  "driver/level2/CMakeFiles/dtrmv_TLU.c"
+  "driver/level2/CMakeFiles/dtbmv_NUN.c"
+  "driver/level2/CMakeFiles/dtbmv_NUU.c"
+  "driver/level2/CMakeFiles/dtbmv_TLN.c"
+  "driver/level2/CMakeFiles/dtbmv_TLU.c"
+  "driver/level2/CMakeFiles/dtbsv_NUN.c"
+  "driver/level2/CMakeFiles/dtbsv_NUU.c"
+  "driver/level2/CMakeFiles/dtbsv_TLN.c"
+  "driver/level2/CMakeFiles/dtbsv_TLU.c"
+  "driver/level2/CMakeFiles/dtpmv_NUN.c"
+  "driver/level2/CMakeFiles/dtpmv_NUU.c"
+  "driver/level2/CMakeFiles/dtpmv_TLN.c"
+  "driver/level2/CMakeFiles/dtpmv_TLU.c"
+  "driver/level2/CMakeFiles/dtpsv_NUN.c"
+  "driver/level2/CMakeFiles/dtpsv_NUU.c"
+  "driver/level2/CMakeFiles/dtpsv_TLN.c"
+  "driver/level2/CMakeFiles/dtpsv_TLU.c"
+  "driver/level2/CMakeFiles/dtrsv_NUN.c"
+  "driver/level2/CMakeFiles/dtrsv_NUU.c"
+  "driver/level2/CMakeFiles/dtrsv_TLN.c"
+  "driver/level2/CMakeFiles/dtrsv_TLU.c"
+  "driver/level2/CMakeFiles/dtrmv_NLN.c"
+  "driver/level2/CMakeFiles/dtrmv_NLU.c"
+  "driver/level2/CMakeFiles/dtrmv_TUN.c"
+  "driver/level2/CMakeFiles/dtrmv_TUU.c"
+  "driver/level2/CMakeFiles/dtbmv_NLN.c"
+  "driver/level2/CMakeFiles/dtbmv_NLU.c"
+  "driver/level2/CMakeFiles/dtbmv_TUN.c"
+  "driver/level2/CMakeFiles/dtbmv_TUU.c"
+  "driver/level2/CMakeFiles/dtbsv_NLN.c"
+  "driver/level2/CMakeFiles/dtbsv_NLU.c"
+  "driver/level2/CMakeFiles/dtbsv_TUN.c"
+  "driver/level2/CMakeFiles/dtbsv_TUU.c"
+  "driver/level2/CMakeFiles/dtpmv_NLN.c"
+  "driver/level2/CMakeFiles/dtpmv_NLU.c"
+  "driver/level2/CMakeFiles/dtpmv_TUN.c"
+  "driver/level2/CMakeFiles/dtpmv_TUU.c"
+  "driver/level2/CMakeFiles/dtpsv_NLN.c"
+  "driver/level2/CMakeFiles/dtpsv_NLU.c"
+  "driver/level2/CMakeFiles/dtpsv_TUN.c"
+  "driver/level2/CMakeFiles/dtpsv_TUU.c"
+  "driver/level2/CMakeFiles/dtrsv_NLN.c"
+  "driver/level2/CMakeFiles/dtrsv_NLU.c"
+  "driver/level2/CMakeFiles/dtrsv_TUN.c"
+  "driver/level2/CMakeFiles/dtrsv_TUU.c"
+  "driver/level2/CMakeFiles/dger_thread.c"
+  "driver/level2/CMakeFiles/dsyr2v_thread_U.c"
+  "driver/level2/CMakeFiles/dsyr2v_thread_L.c"
+  "driver/level2/CMakeFiles/dgemvm_thread_n.c"
+  "driver/level2/CMakeFiles/dgemvm_thread_t.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/dtrmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_NUN.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_NLN.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_NUU.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_NLU.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_TUN.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_TLN.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_TUU.c"
+  "driver/level2/CMakeFiles/dtrsv_thread_TLU.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/dtpmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/dtbmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/cgemv_thread_n.c"
+  "driver/level2/CMakeFiles/cgemv_thread_t.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_n.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_t.c"
+  "driver/level2/CMakeFiles/ctrmv_NUN.c"
+  "driver/level2/CMakeFiles/ctrmv_NUU.c"
+  "driver/level2/CMakeFiles/ctrmv_TLN.c"
+  "driver/level2/CMakeFiles/ctrmv_TLU.c"
+  "driver/level2/CMakeFiles/ctrmv_RUN.c"
+  "driver/level2/CMakeFiles/ctrmv_RUU.c"
+  "driver/level2/CMakeFiles/ctrmv_CLN.c"
+  "driver/level2/CMakeFiles/ctrmv_CLU.c"
+  "driver/level2/CMakeFiles/ctbmv_NUN.c"
+  "driver/level2/CMakeFiles/ctbmv_NUU.c"
+  "driver/level2/CMakeFiles/ctbmv_TLN.c"
+  "driver/level2/CMakeFiles/ctbmv_TLU.c"
+  "driver/level2/CMakeFiles/ctbmv_RUN.c"
+  "driver/level2/CMakeFiles/ctbmv_RUU.c"
+  "driver/level2/CMakeFiles/ctbmv_CLN.c"
+  "driver/level2/CMakeFiles/ctbmv_CLU.c"
+  "driver/level2/CMakeFiles/ctbsv_NUN.c"
+  "driver/level2/CMakeFiles/ctbsv_NUU.c"
+  "driver/level2/CMakeFiles/ctbsv_TLN.c"
+  "driver/level2/CMakeFiles/ctbsv_TLU.c"
+  "driver/level2/CMakeFiles/ctbsv_RUN.c"
+  "driver/level2/CMakeFiles/ctbsv_RUU.c"
+  "driver/level2/CMakeFiles/ctbsv_CLN.c"
+  "driver/level2/CMakeFiles/ctbsv_CLU.c"
+  "driver/level2/CMakeFiles/ctpmv_NUN.c"
+  "driver/level2/CMakeFiles/ctpmv_NUU.c"
+  "driver/level2/CMakeFiles/ctpmv_TLN.c"
+  "driver/level2/CMakeFiles/ctpmv_TLU.c"
+  "driver/level2/CMakeFiles/ctpmv_RUN.c"
+  "driver/level2/CMakeFiles/ctpmv_RUU.c"
+  "driver/level2/CMakeFiles/ctpmv_CLN.c"
+  "driver/level2/CMakeFiles/ctpmv_CLU.c"
+  "driver/level2/CMakeFiles/ctpsv_NUN.c"
+  "driver/level2/CMakeFiles/ctpsv_NUU.c"
+  "driver/level2/CMakeFiles/ctpsv_TLN.c"
+  "driver/level2/CMakeFiles/ctpsv_TLU.c"
+  "driver/level2/CMakeFiles/ctpsv_RUN.c"
+  "driver/level2/CMakeFiles/ctpsv_RUU.c"
+  "driver/level2/CMakeFiles/ctpsv_CLN.c"
+  "driver/level2/CMakeFiles/ctpsv_CLU.c"
+  "driver/level2/CMakeFiles/ctrsv_NUN.c"
+  "driver/level2/CMakeFiles/ctrsv_NUU.c"
+  "driver/level2/CMakeFiles/ctrsv_TLN.c"
+  "driver/level2/CMakeFiles/ctrsv_TLU.c"
+  "driver/level2/CMakeFiles/ctrsv_RUN.c"
+  "driver/level2/CMakeFiles/ctrsv_RUU.c"
+  "driver/level2/CMakeFiles/ctrsv_CLN.c"
+  "driver/level2/CMakeFiles/ctrsv_CLU.c"
+  "driver/level2/CMakeFiles/ctrmv_NLN.c"
+  "driver/level2/CMakeFiles/ctrmv_NLU.c"
+  "driver/level2/CMakeFiles/ctrmv_TUN.c"
+  "driver/level2/CMakeFiles/ctrmv_TUU.c"
+  "driver/level2/CMakeFiles/ctrmv_RLN.c"
+  "driver/level2/CMakeFiles/ctrmv_RLU.c"
+  "driver/level2/CMakeFiles/ctrmv_CUN.c"
+  "driver/level2/CMakeFiles/ctrmv_CUU.c"
+  "driver/level2/CMakeFiles/ctbmv_NLN.c"
+  "driver/level2/CMakeFiles/ctbmv_NLU.c"
+  "driver/level2/CMakeFiles/ctbmv_TUN.c"
+  "driver/level2/CMakeFiles/ctbmv_TUU.c"
+  "driver/level2/CMakeFiles/ctbmv_RLN.c"
+  "driver/level2/CMakeFiles/ctbmv_RLU.c"
+  "driver/level2/CMakeFiles/ctbmv_CUN.c"
+  "driver/level2/CMakeFiles/ctbmv_CUU.c"
+  "driver/level2/CMakeFiles/ctbsv_NLN.c"
+  "driver/level2/CMakeFiles/ctbsv_NLU.c"
+  "driver/level2/CMakeFiles/ctbsv_TUN.c"
+  "driver/level2/CMakeFiles/ctbsv_TUU.c"
+  "driver/level2/CMakeFiles/ctbsv_RLN.c"
+  "driver/level2/CMakeFiles/ctbsv_RLU.c"
+  "driver/level2/CMakeFiles/ctbsv_CUN.c"
+  "driver/level2/CMakeFiles/ctbsv_CUU.c"
+  "driver/level2/CMakeFiles/ctpmv_NLN.c"
+  "driver/level2/CMakeFiles/ctpmv_NLU.c"
+  "driver/level2/CMakeFiles/ctpmv_TUN.c"
+  "driver/level2/CMakeFiles/ctpmv_TUU.c"
+  "driver/level2/CMakeFiles/ctpmv_RLN.c"
+  "driver/level2/CMakeFiles/ctpmv_RLU.c"
+  "driver/level2/CMakeFiles/ctpmv_CUN.c"
+  "driver/level2/CMakeFiles/ctpmv_CUU.c"
+  "driver/level2/CMakeFiles/ctpsv_NLN.c"
+  "driver/level2/CMakeFiles/ctpsv_NLU.c"
+  "driver/level2/CMakeFiles/ctpsv_TUN.c"
+  "driver/level2/CMakeFiles/ctpsv_TUU.c"
+  "driver/level2/CMakeFiles/ctpsv_RLN.c"
+  "driver/level2/CMakeFiles/ctpsv_RLU.c"
+  "driver/level2/CMakeFiles/ctpsv_CUN.c"
+  "driver/level2/CMakeFiles/ctpsv_CUU.c"
+  "driver/level2/CMakeFiles/ctrsv_NLN.c"
+  "driver/level2/CMakeFiles/ctrsv_NLU.c"
+  "driver/level2/CMakeFiles/ctrsv_TUN.c"
+  "driver/level2/CMakeFiles/ctrsv_TUU.c"
+  "driver/level2/CMakeFiles/ctrsv_RLN.c"
+  "driver/level2/CMakeFiles/ctrsv_RLU.c"
+  "driver/level2/CMakeFiles/ctrsv_CUN.c"
+  "driver/level2/CMakeFiles/ctrsv_CUU.c"
+  "driver/level2/CMakeFiles/chbmv_U.c"
+  "driver/level2/CMakeFiles/chbmv_L.c"
+  "driver/level2/CMakeFiles/chbmv_V.c"
+  "driver/level2/CMakeFiles/chbmv_M.c"
+  "driver/level2/CMakeFiles/chpmv_U.c"
+  "driver/level2/CMakeFiles/chpmv_L.c"
+  "driver/level2/CMakeFiles/chpmv_V.c"
+  "driver/level2/CMakeFiles/chpmv_M.c"
+  "driver/level2/CMakeFiles/chpr_U.c"
+  "driver/level2/CMakeFiles/chpr_L.c"
+  "driver/level2/CMakeFiles/chpr_V.c"
+  "driver/level2/CMakeFiles/chpr_M.c"
+  "driver/level2/CMakeFiles/chpr2_U.c"
+  "driver/level2/CMakeFiles/chpr2_L.c"
+  "driver/level2/CMakeFiles/chpr2_V.c"
+  "driver/level2/CMakeFiles/chpr2_M.c"
+  "driver/level2/CMakeFiles/cher_U.c"
+  "driver/level2/CMakeFiles/cher_L.c"
+  "driver/level2/CMakeFiles/cher_V.c"
+  "driver/level2/CMakeFiles/cher_M.c"
+  "driver/level2/CMakeFiles/cher2_U.c"
+  "driver/level2/CMakeFiles/cher2_L.c"
+  "driver/level2/CMakeFiles/cher2_V.c"
+  "driver/level2/CMakeFiles/cher2_M.c"
+  "driver/level2/CMakeFiles/cgemv_thread_r.c"
+  "driver/level2/CMakeFiles/cgemv_thread_c.c"
+  "driver/level2/CMakeFiles/cgemv_thread_o.c"
+  "driver/level2/CMakeFiles/cgemv_thread_u.c"
+  "driver/level2/CMakeFiles/cgemv_thread_s.c"
+  "driver/level2/CMakeFiles/cgemv_thread_d.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_r.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_c.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_o.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_u.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_s.c"
+  "driver/level2/CMakeFiles/cgbmv_thread_d.c"
+  "driver/level2/CMakeFiles/cger_thread_U.c"
+  "driver/level2/CMakeFiles/cger_thread_C.c"
+  "driver/level2/CMakeFiles/cger_thread_V.c"
+  "driver/level2/CMakeFiles/cger_thread_D.c"
+  "driver/level2/CMakeFiles/chbmv_thread_U.c"
+  "driver/level2/CMakeFiles/chbmv_thread_L.c"
+  "driver/level2/CMakeFiles/chbmv_thread_V.c"
+  "driver/level2/CMakeFiles/chbmv_thread_M.c"
+  "driver/level2/CMakeFiles/chpmv_thread_U.c"
+  "driver/level2/CMakeFiles/chpmv_thread_L.c"
+  "driver/level2/CMakeFiles/chpmv_thread_V.c"
+  "driver/level2/CMakeFiles/chpmv_thread_M.c"
+  "driver/level2/CMakeFiles/chpr_thread_U.c"
+  "driver/level2/CMakeFiles/chpr_thread_L.c"
+  "driver/level2/CMakeFiles/chpr_thread_V.c"
+  "driver/level2/CMakeFiles/chpr_thread_M.c"
+  "driver/level2/CMakeFiles/chpr2_thread_U.c"
+  "driver/level2/CMakeFiles/chpr2_thread_L.c"
+  "driver/level2/CMakeFiles/chpr2_thread_V.c"
+  "driver/level2/CMakeFiles/chpr2_thread_M.c"
+  "driver/level2/CMakeFiles/chemv_thread_U.c"
+  "driver/level2/CMakeFiles/chemv_thread_L.c"
+  "driver/level2/CMakeFiles/chemv_thread_V.c"
+  "driver/level2/CMakeFiles/chemv_thread_M.c"
+  "driver/level2/CMakeFiles/cher_thread_U.c"
+  "driver/level2/CMakeFiles/cher_thread_L.c"
+  "driver/level2/CMakeFiles/cher_thread_V.c"
+  "driver/level2/CMakeFiles/cher_thread_M.c"
+  "driver/level2/CMakeFiles/cher2_thread_U.c"
+  "driver/level2/CMakeFiles/cher2_thread_L.c"
+  "driver/level2/CMakeFiles/cher2_thread_V.c"
+  "driver/level2/CMakeFiles/cher2_thread_M.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ctrmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ctrsv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ctpmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ctbmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/zgemv_thread_n.c"
+  "driver/level2/CMakeFiles/zgemv_thread_t.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_n.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_t.c"
+  "driver/level2/CMakeFiles/ztrmv_NUN.c"
+  "driver/level2/CMakeFiles/ztrmv_NUU.c"
+  "driver/level2/CMakeFiles/ztrmv_TLN.c"
+  "driver/level2/CMakeFiles/ztrmv_TLU.c"
+  "driver/level2/CMakeFiles/ztrmv_RUN.c"
+  "driver/level2/CMakeFiles/ztrmv_RUU.c"
+  "driver/level2/CMakeFiles/ztrmv_CLN.c"
+  "driver/level2/CMakeFiles/ztrmv_CLU.c"
+  "driver/level2/CMakeFiles/ztbmv_NUN.c"
+  "driver/level2/CMakeFiles/ztbmv_NUU.c"
+  "driver/level2/CMakeFiles/ztbmv_TLN.c"
+  "driver/level2/CMakeFiles/ztbmv_TLU.c"
+  "driver/level2/CMakeFiles/ztbmv_RUN.c"
+  "driver/level2/CMakeFiles/ztbmv_RUU.c"
+  "driver/level2/CMakeFiles/ztbmv_CLN.c"
+  "driver/level2/CMakeFiles/ztbmv_CLU.c"
+  "driver/level2/CMakeFiles/ztbsv_NUN.c"
+  "driver/level2/CMakeFiles/ztbsv_NUU.c"
+  "driver/level2/CMakeFiles/ztbsv_TLN.c"
+  "driver/level2/CMakeFiles/ztbsv_TLU.c"
+  "driver/level2/CMakeFiles/ztbsv_RUN.c"
+  "driver/level2/CMakeFiles/ztbsv_RUU.c"
+  "driver/level2/CMakeFiles/ztbsv_CLN.c"
+  "driver/level2/CMakeFiles/ztbsv_CLU.c"
+  "driver/level2/CMakeFiles/ztpmv_NUN.c"
+  "driver/level2/CMakeFiles/ztpmv_NUU.c"
+  "driver/level2/CMakeFiles/ztpmv_TLN.c"
+  "driver/level2/CMakeFiles/ztpmv_TLU.c"
+  "driver/level2/CMakeFiles/ztpmv_RUN.c"
+  "driver/level2/CMakeFiles/ztpmv_RUU.c"
+  "driver/level2/CMakeFiles/ztpmv_CLN.c"
+  "driver/level2/CMakeFiles/ztpmv_CLU.c"
+  "driver/level2/CMakeFiles/ztpsv_NUN.c"
+  "driver/level2/CMakeFiles/ztpsv_NUU.c"
+  "driver/level2/CMakeFiles/ztpsv_TLN.c"
+  "driver/level2/CMakeFiles/ztpsv_TLU.c"
+  "driver/level2/CMakeFiles/ztpsv_RUN.c"
+  "driver/level2/CMakeFiles/ztpsv_RUU.c"
+  "driver/level2/CMakeFiles/ztpsv_CLN.c"
+  "driver/level2/CMakeFiles/ztpsv_CLU.c"
+  "driver/level2/CMakeFiles/ztrsv_NUN.c"
+  "driver/level2/CMakeFiles/ztrsv_NUU.c"
+  "driver/level2/CMakeFiles/ztrsv_TLN.c"
+  "driver/level2/CMakeFiles/ztrsv_TLU.c"
+  "driver/level2/CMakeFiles/ztrsv_RUN.c"
+  "driver/level2/CMakeFiles/ztrsv_RUU.c"
+  "driver/level2/CMakeFiles/ztrsv_CLN.c"
+  "driver/level2/CMakeFiles/ztrsv_CLU.c"
+  "driver/level2/CMakeFiles/ztrmv_NLN.c"
+  "driver/level2/CMakeFiles/ztrmv_NLU.c"
+  "driver/level2/CMakeFiles/ztrmv_TUN.c"
+  "driver/level2/CMakeFiles/ztrmv_TUU.c"
+  "driver/level2/CMakeFiles/ztrmv_RLN.c"
+  "driver/level2/CMakeFiles/ztrmv_RLU.c"
+  "driver/level2/CMakeFiles/ztrmv_CUN.c"
+  "driver/level2/CMakeFiles/ztrmv_CUU.c"
+  "driver/level2/CMakeFiles/ztbmv_NLN.c"
+  "driver/level2/CMakeFiles/ztbmv_NLU.c"
+  "driver/level2/CMakeFiles/ztbmv_TUN.c"
+  "driver/level2/CMakeFiles/ztbmv_TUU.c"
+  "driver/level2/CMakeFiles/ztbmv_RLN.c"
+  "driver/level2/CMakeFiles/ztbmv_RLU.c"
+  "driver/level2/CMakeFiles/ztbmv_CUN.c"
+  "driver/level2/CMakeFiles/ztbmv_CUU.c"
+  "driver/level2/CMakeFiles/ztbsv_NLN.c"
+  "driver/level2/CMakeFiles/ztbsv_NLU.c"
+  "driver/level2/CMakeFiles/ztbsv_TUN.c"
+  "driver/level2/CMakeFiles/ztbsv_TUU.c"
+  "driver/level2/CMakeFiles/ztbsv_RLN.c"
+  "driver/level2/CMakeFiles/ztbsv_RLU.c"
+  "driver/level2/CMakeFiles/ztbsv_CUN.c"
+  "driver/level2/CMakeFiles/ztbsv_CUU.c"
+  "driver/level2/CMakeFiles/ztpmv_NLN.c"
+  "driver/level2/CMakeFiles/ztpmv_NLU.c"
+  "driver/level2/CMakeFiles/ztpmv_TUN.c"
+  "driver/level2/CMakeFiles/ztpmv_TUU.c"
+  "driver/level2/CMakeFiles/ztpmv_RLN.c"
+  "driver/level2/CMakeFiles/ztpmv_RLU.c"
+  "driver/level2/CMakeFiles/ztpmv_CUN.c"
+  "driver/level2/CMakeFiles/ztpmv_CUU.c"
+  "driver/level2/CMakeFiles/ztpsv_NLN.c"
+  "driver/level2/CMakeFiles/ztpsv_NLU.c"
+  "driver/level2/CMakeFiles/ztpsv_TUN.c"
+  "driver/level2/CMakeFiles/ztpsv_TUU.c"
+  "driver/level2/CMakeFiles/ztpsv_RLN.c"
+  "driver/level2/CMakeFiles/ztpsv_RLU.c"
+  "driver/level2/CMakeFiles/ztpsv_CUN.c"
+  "driver/level2/CMakeFiles/ztpsv_CUU.c"
+  "driver/level2/CMakeFiles/ztrsv_NLN.c"
+  "driver/level2/CMakeFiles/ztrsv_NLU.c"
+  "driver/level2/CMakeFiles/ztrsv_TUN.c"
+  "driver/level2/CMakeFiles/ztrsv_TUU.c"
+  "driver/level2/CMakeFiles/ztrsv_RLN.c"
+  "driver/level2/CMakeFiles/ztrsv_RLU.c"
+  "driver/level2/CMakeFiles/ztrsv_CUN.c"
+  "driver/level2/CMakeFiles/ztrsv_CUU.c"
+  "driver/level2/CMakeFiles/zhbmv_U.c"
+  "driver/level2/CMakeFiles/zhbmv_L.c"
+  "driver/level2/CMakeFiles/zhbmv_V.c"
+  "driver/level2/CMakeFiles/zhbmv_M.c"
+  "driver/level2/CMakeFiles/zhpmv_U.c"
+  "driver/level2/CMakeFiles/zhpmv_L.c"
+  "driver/level2/CMakeFiles/zhpmv_V.c"
+  "driver/level2/CMakeFiles/zhpmv_M.c"
+  "driver/level2/CMakeFiles/zhpr_U.c"
+  "driver/level2/CMakeFiles/zhpr_L.c"
+  "driver/level2/CMakeFiles/zhpr_V.c"
+  "driver/level2/CMakeFiles/zhpr_M.c"
+  "driver/level2/CMakeFiles/zhpr2_U.c"
+  "driver/level2/CMakeFiles/zhpr2_L.c"
+  "driver/level2/CMakeFiles/zhpr2_V.c"
+  "driver/level2/CMakeFiles/zhpr2_M.c"
+  "driver/level2/CMakeFiles/zher_U.c"
+  "driver/level2/CMakeFiles/zher_L.c"
+  "driver/level2/CMakeFiles/zher_V.c"
+  "driver/level2/CMakeFiles/zher_M.c"
+  "driver/level2/CMakeFiles/zher2_U.c"
+  "driver/level2/CMakeFiles/zher2_L.c"
+  "driver/level2/CMakeFiles/zher2_V.c"
+  "driver/level2/CMakeFiles/zher2_M.c"
+  "driver/level2/CMakeFiles/zgemv_thread_r.c"
+  "driver/level2/CMakeFiles/zgemv_thread_c.c"
+  "driver/level2/CMakeFiles/zgemv_thread_o.c"
+  "driver/level2/CMakeFiles/zgemv_thread_u.c"
+  "driver/level2/CMakeFiles/zgemv_thread_s.c"
+  "driver/level2/CMakeFiles/zgemv_thread_d.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_r.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_c.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_o.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_u.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_s.c"
+  "driver/level2/CMakeFiles/zgbmv_thread_d.c"
+  "driver/level2/CMakeFiles/zger_thread_U.c"
+  "driver/level2/CMakeFiles/zger_thread_C.c"
+  "driver/level2/CMakeFiles/zger_thread_V.c"
+  "driver/level2/CMakeFiles/zger_thread_D.c"
+  "driver/level2/CMakeFiles/zhbmv_thread_U.c"
+  "driver/level2/CMakeFiles/zhbmv_thread_L.c"
+  "driver/level2/CMakeFiles/zhbmv_thread_V.c"
+  "driver/level2/CMakeFiles/zhbmv_thread_M.c"
+  "driver/level2/CMakeFiles/zhpmv_thread_U.c"
+  "driver/level2/CMakeFiles/zhpmv_thread_L.c"
+  "driver/level2/CMakeFiles/zhpmv_thread_V.c"
+  "driver/level2/CMakeFiles/zhpmv_thread_M.c"
+  "driver/level2/CMakeFiles/zhpr_thread_U.c"
+  "driver/level2/CMakeFiles/zhpr_thread_L.c"
+  "driver/level2/CMakeFiles/zhpr_thread_V.c"
+  "driver/level2/CMakeFiles/zhpr_thread_M.c"
+  "driver/level2/CMakeFiles/zhpr2_thread_U.c"
+  "driver/level2/CMakeFiles/zhpr2_thread_L.c"
+  "driver/level2/CMakeFiles/zhpr2_thread_V.c"
+  "driver/level2/CMakeFiles/zhpr2_thread_M.c"
+  "driver/level2/CMakeFiles/zhemv_thread_U.c"
+  "driver/level2/CMakeFiles/zhemv_thread_L.c"
+  "driver/level2/CMakeFiles/zhemv_thread_V.c"
+  "driver/level2/CMakeFiles/zhemv_thread_M.c"
+  "driver/level2/CMakeFiles/zher_thread_U.c"
+  "driver/level2/CMakeFiles/zher_thread_L.c"
+  "driver/level2/CMakeFiles/zher_thread_V.c"
+  "driver/level2/CMakeFiles/zher_thread_M.c"
+  "driver/level2/CMakeFiles/zher2_thread_U.c"
+  "driver/level2/CMakeFiles/zher2_thread_L.c"
+  "driver/level2/CMakeFiles/zher2_thread_V.c"
+  "driver/level2/CMakeFiles/zher2_thread_M.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ztrmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ztrsv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ztpmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_NUN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_NLN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_NUU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_NLU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_TUN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_TLN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_TUU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_TLU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_RUN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_RLN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_RUU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_RLU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_CUN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_CLN.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_CUU.c"
+  "driver/level2/CMakeFiles/ztbmv_thread_CLU.c"
+  "driver/level2/CMakeFiles/sbgemv_thread_n.c"
+  "driver/level2/CMakeFiles/sbgemv_thread_t.c"
+  "driver/level2/CMakeFiles/ssymv_thread_U.c"
+  "driver/level2/CMakeFiles/dsymv_thread_U.c"
+  "driver/level2/CMakeFiles/csymv_thread_U.c"
+  "driver/level2/CMakeFiles/zsymv_thread_U.c"
+  "driver/level2/CMakeFiles/ssyr_thread_U.c"
+  "driver/level2/CMakeFiles/dsyr_thread_U.c"
+  "driver/level2/CMakeFiles/csyr_thread_U.c"
+  "driver/level2/CMakeFiles/zsyr_thread_U.c"
+  "driver/level2/CMakeFiles/ssyr2_thread_U.c"
+  "driver/level2/CMakeFiles/dsyr2_thread_U.c"
+  "driver/level2/CMakeFiles/csyr2_thread_U.c"
+  "driver/level2/CMakeFiles/zsyr2_thread_U.c"
+  "driver/level2/CMakeFiles/sspr_thread_U.c"
+  "driver/level2/CMakeFiles/dspr_thread_U.c"
+  "driver/level2/CMakeFiles/cspr_thread_U.c"
+  "driver/level2/CMakeFiles/zspr_thread_U.c"
+  "driver/level2/CMakeFiles/sspr2_thread_U.c"
+  "driver/level2/CMakeFiles/dspr2_thread_U.c"
+  "driver/level2/CMakeFiles/cspr2_thread_U.c"
+  "driver/level2/CMakeFiles/zspr2_thread_U.c"
+  "driver/level2/CMakeFiles/sspmv_thread_U.c"
+  "driver/level2/CMakeFiles/dspmv_thread_U.c"
+  "driver/level2/CMakeFiles/cspmv_thread_U.c"
+  "driver/level2/CMakeFiles/zspmv_thread_U.c"
+  "driver/level2/CMakeFiles/ssbmv_thread_U.c"
+  "driver/level2/CMakeFiles/dsbmv_thread_U.c"
+  "driver/level2/CMakeFiles/csbmv_thread_U.c"
+  "driver/level2/CMakeFiles/zsbmv_thread_U.c"
+  "driver/level2/CMakeFiles/ssymv_thread_L.c"
+  "driver/level2/CMakeFiles/dsymv_thread_L.c"
+  "driver/level2/CMakeFiles/csymv_thread_L.c"
+  "driver/level2/CMakeFiles/zsymv_thread_L.c"
+  "driver/level2/CMakeFiles/ssyr_thread_L.c"
+  "driver/level2/CMakeFiles/dsyr_thread_L.c"
+  "driver/level2/CMakeFiles/csyr_thread_L.c"
+  "driver/level2/CMakeFiles/zsyr_thread_L.c"
+  "driver/level2/CMakeFiles/ssyr2_thread_L.c"
+  "driver/level2/CMakeFiles/dsyr2_thread_L.c"
+  "driver/level2/CMakeFiles/csyr2_thread_L.c"
+  "driver/level2/CMakeFiles/zsyr2_thread_L.c"
+  "driver/level2/CMakeFiles/sspr_thread_L.c"
+  "driver/level2/CMakeFiles/dspr_thread_L.c"
+  "driver/level2/CMakeFiles/cspr_thread_L.c"
+  "driver/level2/CMakeFiles/zspr_thread_L.c"
+  "driver/level2/CMakeFiles/sspr2_thread_L.c"
+  "driver/level2/CMakeFiles/dspr2_thread_L.c"
+  "driver/level2/CMakeFiles/cspr2_thread_L.c"
+  "driver/level2/CMakeFiles/zspr2_thread_L.c"
+  "driver/level2/CMakeFiles/sspmv_thread_L.c"
+  "driver/level2/CMakeFiles/dspmv_thread_L.c"
+  "driver/level2/CMakeFiles/cspmv_thread_L.c"
+  "driver/level2/CMakeFiles/zspmv_thread_L.c"
+  "driver/level2/CMakeFiles/ssbmv_thread_L.c"
+  "driver/level2/CMakeFiles/dsbmv_thread_L.c"
+  "driver/level2/CMakeFiles/csbmv_thread_L.c"
+  "driver/level2/CMakeFiles/zsbmv_thread_L.c"
+  "driver/level2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "driver/level3/CMakeFiles/sgemm_nn.c"
+  "driver/level3/CMakeFiles/dgemm_nn.c"
+  "driver/level3/CMakeFiles/cgemm_nn.c"
+  "driver/level3/CMakeFiles/zgemm_nn.c"
+  "driver/level3/CMakeFiles/sgemm_thread_nn.c"
+  "driver/level3/CMakeFiles/dgemm_thread_nn.c"
+  "driver/level3/CMakeFiles/cgemm_thread_nn.c"
+  "driver/level3/CMakeFiles/zgemm_thread_nn.c"
+  "driver/level3/CMakeFiles/sbgemm_nn.c"
+  "driver/level3/CMakeFiles/sbgemm_thread_nn.c"
+  "driver/level3/CMakeFiles/sgemm_nt.c"
+  "driver/level3/CMakeFiles/dgemm_nt.c"
+  "driver/level3/CMakeFiles/cgemm_nt.c"
+  "driver/level3/CMakeFiles/zgemm_nt.c"
+  "driver/level3/CMakeFiles/sgemm_thread_nt.c"
+  "driver/level3/CMakeFiles/dgemm_thread_nt.c"
+  "driver/level3/CMakeFiles/cgemm_thread_nt.c"
+  "driver/level3/CMakeFiles/zgemm_thread_nt.c"
+  "driver/level3/CMakeFiles/sbgemm_nt.c"
+  "driver/level3/CMakeFiles/sbgemm_thread_nt.c"
+  "driver/level3/CMakeFiles/sgemm_tn.c"
+  "driver/level3/CMakeFiles/dgemm_tn.c"
+  "driver/level3/CMakeFiles/cgemm_tn.c"
+  "driver/level3/CMakeFiles/zgemm_tn.c"
+  "driver/level3/CMakeFiles/sgemm_thread_tn.c"
+  "driver/level3/CMakeFiles/dgemm_thread_tn.c"
+  "driver/level3/CMakeFiles/cgemm_thread_tn.c"
+  "driver/level3/CMakeFiles/zgemm_thread_tn.c"
+  "driver/level3/CMakeFiles/sbgemm_tn.c"
+  "driver/level3/CMakeFiles/sbgemm_thread_tn.c"
+  "driver/level3/CMakeFiles/sgemm_tt.c"
+  "driver/level3/CMakeFiles/dgemm_tt.c"
+  "driver/level3/CMakeFiles/cgemm_tt.c"
+  "driver/level3/CMakeFiles/zgemm_tt.c"
+  "driver/level3/CMakeFiles/sgemm_thread_tt.c"
+  "driver/level3/CMakeFiles/dgemm_thread_tt.c"
+  "driver/level3/CMakeFiles/cgemm_thread_tt.c"
+  "driver/level3/CMakeFiles/zgemm_thread_tt.c"
+  "driver/level3/CMakeFiles/sbgemm_tt.c"
+  "driver/level3/CMakeFiles/sbgemm_thread_tt.c"
+  "driver/level3/CMakeFiles/sgemm_packed_copy.c"
+  "driver/level3/CMakeFiles/dgemm_packed_copy.c"
+  "driver/level3/CMakeFiles/sgemm_packed_compute.c"
+  "driver/level3/CMakeFiles/dgemm_packed_compute.c"
+  "driver/level3/CMakeFiles/sbgemm_packed_copy.c"
+  "driver/level3/CMakeFiles/sbgemm_packed_compute.c"
+  "driver/level3/CMakeFiles/sbgemm_epilogue.c"
+  "driver/level3/CMakeFiles/strmm_LNLN.c"
+  "driver/level3/CMakeFiles/dtrmm_LNLN.c"
+  "driver/level3/CMakeFiles/ctrmm_LNLN.c"
+  "driver/level3/CMakeFiles/ztrmm_LNLN.c"
+  "driver/level3/CMakeFiles/strmm_LNUN.c"
+  "driver/level3/CMakeFiles/dtrmm_LNUN.c"
+  "driver/level3/CMakeFiles/ctrmm_LNUN.c"
+  "driver/level3/CMakeFiles/ztrmm_LNUN.c"
+  "driver/level3/CMakeFiles/strmm_LNLU.c"
+  "driver/level3/CMakeFiles/dtrmm_LNLU.c"
+  "driver/level3/CMakeFiles/ctrmm_LNLU.c"
+  "driver/level3/CMakeFiles/ztrmm_LNLU.c"
+  "driver/level3/CMakeFiles/strmm_LNUU.c"
+  "driver/level3/CMakeFiles/dtrmm_LNUU.c"
+  "driver/level3/CMakeFiles/ctrmm_LNUU.c"
+  "driver/level3/CMakeFiles/ztrmm_LNUU.c"
+  "driver/level3/CMakeFiles/strmm_LTLN.c"
+  "driver/level3/CMakeFiles/dtrmm_LTLN.c"
+  "driver/level3/CMakeFiles/ctrmm_LTLN.c"
+  "driver/level3/CMakeFiles/ztrmm_LTLN.c"
+  "driver/level3/CMakeFiles/strmm_LTUN.c"
+  "driver/level3/CMakeFiles/dtrmm_LTUN.c"
+  "driver/level3/CMakeFiles/ctrmm_LTUN.c"
+  "driver/level3/CMakeFiles/ztrmm_LTUN.c"
+  "driver/level3/CMakeFiles/strmm_LTLU.c"
+  "driver/level3/CMakeFiles/dtrmm_LTLU.c"
+  "driver/level3/CMakeFiles/ctrmm_LTLU.c"
+  "driver/level3/CMakeFiles/ztrmm_LTLU.c"
+  "driver/level3/CMakeFiles/strmm_LTUU.c"
+  "driver/level3/CMakeFiles/dtrmm_LTUU.c"
+  "driver/level3/CMakeFiles/ctrmm_LTUU.c"
+  "driver/level3/CMakeFiles/ztrmm_LTUU.c"
+  "driver/level3/CMakeFiles/strmm_RNLN.c"
+  "driver/level3/CMakeFiles/dtrmm_RNLN.c"
+  "driver/level3/CMakeFiles/ctrmm_RNLN.c"
+  "driver/level3/CMakeFiles/ztrmm_RNLN.c"
+  "driver/level3/CMakeFiles/strmm_RNUN.c"
+  "driver/level3/CMakeFiles/dtrmm_RNUN.c"
+  "driver/level3/CMakeFiles/ctrmm_RNUN.c"
+  "driver/level3/CMakeFiles/ztrmm_RNUN.c"
+  "driver/level3/CMakeFiles/strmm_RNLU.c"
+  "driver/level3/CMakeFiles/dtrmm_RNLU.c"
+  "driver/level3/CMakeFiles/ctrmm_RNLU.c"
+  "driver/level3/CMakeFiles/ztrmm_RNLU.c"
+  "driver/level3/CMakeFiles/strmm_RNUU.c"
+  "driver/level3/CMakeFiles/dtrmm_RNUU.c"
+  "driver/level3/CMakeFiles/ctrmm_RNUU.c"
+  "driver/level3/CMakeFiles/ztrmm_RNUU.c"
+  "driver/level3/CMakeFiles/strmm_RTLN.c"
+  "driver/level3/CMakeFiles/dtrmm_RTLN.c"
+  "driver/level3/CMakeFiles/ctrmm_RTLN.c"
+  "driver/level3/CMakeFiles/ztrmm_RTLN.c"
+  "driver/level3/CMakeFiles/strmm_RTUN.c"
+  "driver/level3/CMakeFiles/dtrmm_RTUN.c"
+  "driver/level3/CMakeFiles/ctrmm_RTUN.c"
+  "driver/level3/CMakeFiles/ztrmm_RTUN.c"
+  "driver/level3/CMakeFiles/strmm_RTLU.c"
+  "driver/level3/CMakeFiles/dtrmm_RTLU.c"
+  "driver/level3/CMakeFiles/ctrmm_RTLU.c"
+  "driver/level3/CMakeFiles/ztrmm_RTLU.c"
+  "driver/level3/CMakeFiles/strmm_RTUU.c"
+  "driver/level3/CMakeFiles/dtrmm_RTUU.c"
+  "driver/level3/CMakeFiles/ctrmm_RTUU.c"
+  "driver/level3/CMakeFiles/ztrmm_RTUU.c"
+  "driver/level3/CMakeFiles/strsm_LNLN.c"
+  "driver/level3/CMakeFiles/dtrsm_LNLN.c"
+  "driver/level3/CMakeFiles/ctrsm_LNLN.c"
+  "driver/level3/CMakeFiles/ztrsm_LNLN.c"
+  "driver/level3/CMakeFiles/strsm_LNUN.c"
+  "driver/level3/CMakeFiles/dtrsm_LNUN.c"
+  "driver/level3/CMakeFiles/ctrsm_LNUN.c"
+  "driver/level3/CMakeFiles/ztrsm_LNUN.c"
+  "driver/level3/CMakeFiles/strsm_LNLU.c"
+  "driver/level3/CMakeFiles/dtrsm_LNLU.c"
+  "driver/level3/CMakeFiles/ctrsm_LNLU.c"
+  "driver/level3/CMakeFiles/ztrsm_LNLU.c"
+  "driver/level3/CMakeFiles/strsm_LNUU.c"
+  "driver/level3/CMakeFiles/dtrsm_LNUU.c"
+  "driver/level3/CMakeFiles/ctrsm_LNUU.c"
+  "driver/level3/CMakeFiles/ztrsm_LNUU.c"
+  "driver/level3/CMakeFiles/strsm_LTLN.c"
+  "driver/level3/CMakeFiles/dtrsm_LTLN.c"
+  "driver/level3/CMakeFiles/ctrsm_LTLN.c"
+  "driver/level3/CMakeFiles/ztrsm_LTLN.c"
+  "driver/level3/CMakeFiles/strsm_LTUN.c"
+  "driver/level3/CMakeFiles/dtrsm_LTUN.c"
+  "driver/level3/CMakeFiles/ctrsm_LTUN.c"
+  "driver/level3/CMakeFiles/ztrsm_LTUN.c"
+  "driver/level3/CMakeFiles/strsm_LTLU.c"
+  "driver/level3/CMakeFiles/dtrsm_LTLU.c"
+  "driver/level3/CMakeFiles/ctrsm_LTLU.c"
+  "driver/level3/CMakeFiles/ztrsm_LTLU.c"
+  "driver/level3/CMakeFiles/strsm_LTUU.c"
+  "driver/level3/CMakeFiles/dtrsm_LTUU.c"
+  "driver/level3/CMakeFiles/ctrsm_LTUU.c"
+  "driver/level3/CMakeFiles/ztrsm_LTUU.c"
+  "driver/level3/CMakeFiles/strsm_RNLN.c"
+  "driver/level3/CMakeFiles/dtrsm_RNLN.c"
+  "driver/level3/CMakeFiles/ctrsm_RNLN.c"
+  "driver/level3/CMakeFiles/ztrsm_RNLN.c"
+  "driver/level3/CMakeFiles/strsm_RNUN.c"
+  "driver/level3/CMakeFiles/dtrsm_RNUN.c"
+  "driver/level3/CMakeFiles/ctrsm_RNUN.c"
+  "driver/level3/CMakeFiles/ztrsm_RNUN.c"
+  "driver/level3/CMakeFiles/strsm_RNLU.c"
+  "driver/level3/CMakeFiles/dtrsm_RNLU.c"
+  "driver/level3/CMakeFiles/ctrsm_RNLU.c"
+  "driver/level3/CMakeFiles/ztrsm_RNLU.c"
+  "driver/level3/CMakeFiles/strsm_RNUU.c"
+  "driver/level3/CMakeFiles/dtrsm_RNUU.c"
+  "driver/level3/CMakeFiles/ctrsm_RNUU.c"
+  "driver/level3/CMakeFiles/ztrsm_RNUU.c"
+  "driver/level3/CMakeFiles/strsm_RTLN.c"
+  "driver/level3/CMakeFiles/dtrsm_RTLN.c"
+  "driver/level3/CMakeFiles/ctrsm_RTLN.c"
+  "driver/level3/CMakeFiles/ztrsm_RTLN.c"
+  "driver/level3/CMakeFiles/strsm_RTUN.c"
+  "driver/level3/CMakeFiles/dtrsm_RTUN.c"
+  "driver/level3/CMakeFiles/ctrsm_RTUN.c"
+  "driver/level3/CMakeFiles/ztrsm_RTUN.c"
+  "driver/level3/CMakeFiles/strsm_RTLU.c"
+  "driver/level3/CMakeFiles/dtrsm_RTLU.c"
+  "driver/level3/CMakeFiles/ctrsm_RTLU.c"
+  "driver/level3/CMakeFiles/ztrsm_RTLU.c"
+  "driver/level3/CMakeFiles/strsm_RTUU.c"
+  "driver/level3/CMakeFiles/dtrsm_RTUU.c"
+  "driver/level3/CMakeFiles/ctrsm_RTUU.c"
+  "driver/level3/CMakeFiles/ztrsm_RTUU.c"
+  "driver/level3/CMakeFiles/ssymm_LU.c"
+  "driver/level3/CMakeFiles/dsymm_LU.c"
+  "driver/level3/CMakeFiles/csymm_LU.c"
+  "driver/level3/CMakeFiles/zsymm_LU.c"
+  "driver/level3/CMakeFiles/ssymm_RU.c"
+  "driver/level3/CMakeFiles/dsymm_RU.c"
+  "driver/level3/CMakeFiles/csymm_RU.c"
+  "driver/level3/CMakeFiles/zsymm_RU.c"
+  "driver/level3/CMakeFiles/ssymm_LL.c"
+  "driver/level3/CMakeFiles/dsymm_LL.c"
+  "driver/level3/CMakeFiles/csymm_LL.c"
+  "driver/level3/CMakeFiles/zsymm_LL.c"
+  "driver/level3/CMakeFiles/ssymm_RL.c"
+  "driver/level3/CMakeFiles/dsymm_RL.c"
+  "driver/level3/CMakeFiles/csymm_RL.c"
+  "driver/level3/CMakeFiles/zsymm_RL.c"
+  "driver/level3/CMakeFiles/ssyrk_UN.c"
+  "driver/level3/CMakeFiles/dsyrk_UN.c"
+  "driver/level3/CMakeFiles/csyrk_UN.c"
+  "driver/level3/CMakeFiles/zsyrk_UN.c"
+  "driver/level3/CMakeFiles/ssyrk_LN.c"
+  "driver/level3/CMakeFiles/dsyrk_LN.c"
+  "driver/level3/CMakeFiles/csyrk_LN.c"
+  "driver/level3/CMakeFiles/zsyrk_LN.c"
+  "driver/level3/CMakeFiles/ssyrk_UT.c"
+  "driver/level3/CMakeFiles/dsyrk_UT.c"
+  "driver/level3/CMakeFiles/csyrk_UT.c"
+  "driver/level3/CMakeFiles/zsyrk_UT.c"
+  "driver/level3/CMakeFiles/ssyrk_LT.c"
+  "driver/level3/CMakeFiles/dsyrk_LT.c"
+  "driver/level3/CMakeFiles/csyrk_LT.c"
+  "driver/level3/CMakeFiles/zsyrk_LT.c"
+  "driver/level3/CMakeFiles/ssyr2k_UN.c"
+  "driver/level3/CMakeFiles/dsyr2k_UN.c"
+  "driver/level3/CMakeFiles/csyr2k_UN.c"
+  "driver/level3/CMakeFiles/zsyr2k_UN.c"
+  "driver/level3/CMakeFiles/ssyr2k_LN.c"
+  "driver/level3/CMakeFiles/dsyr2k_LN.c"
+  "driver/level3/CMakeFiles/csyr2k_LN.c"
+  "driver/level3/CMakeFiles/zsyr2k_LN.c"
+  "driver/level3/CMakeFiles/ssyr2k_UT.c"
+  "driver/level3/CMakeFiles/dsyr2k_UT.c"
+  "driver/level3/CMakeFiles/csyr2k_UT.c"
+  "driver/level3/CMakeFiles/zsyr2k_UT.c"
+  "driver/level3/CMakeFiles/ssyr2k_LT.c"
+  "driver/level3/CMakeFiles/dsyr2k_LT.c"
+  "driver/level3/CMakeFiles/csyr2k_LT.c"
+  "driver/level3/CMakeFiles/zsyr2k_LT.c"
+  "driver/level3/CMakeFiles/ssyrk_kernel_U.c"
+  "driver/level3/CMakeFiles/dsyrk_kernel_U.c"
+  "driver/level3/CMakeFiles/csyrk_kernel_U.c"
+  "driver/level3/CMakeFiles/zsyrk_kernel_U.c"
+  "driver/level3/CMakeFiles/ssyrk_kernel_L.c"
+  "driver/level3/CMakeFiles/dsyrk_kernel_L.c"
+  "driver/level3/CMakeFiles/csyrk_kernel_L.c"
+  "driver/level3/CMakeFiles/zsyrk_kernel_L.c"
+  "driver/level3/CMakeFiles/ssyr2k_kernel_U.c"
+  "driver/level3/CMakeFiles/dsyr2k_kernel_U.c"
+  "driver/level3/CMakeFiles/csyr2k_kernel_U.c"
+  "driver/level3/CMakeFiles/zsyr2k_kernel_U.c"
+  "driver/level3/CMakeFiles/ssyr2k_kernel_L.c"
+  "driver/level3/CMakeFiles/dsyr2k_kernel_L.c"
+  "driver/level3/CMakeFiles/csyr2k_kernel_L.c"
+  "driver/level3/CMakeFiles/zsyr2k_kernel_L.c"
+  "driver/level3/CMakeFiles/gemm_thread_m.c"
+  "driver/level3/CMakeFiles/gemm_thread_n.c"
+  "driver/level3/CMakeFiles/gemm_thread_mn.c"
+  "driver/level3/CMakeFiles/gemm_thread_variable.c"
+  "driver/level3/CMakeFiles/gemm_batch_thread.c"
+  "driver/level3/CMakeFiles/gemm_thread_steal.c"
+  "driver/level3/CMakeFiles/syrk_thread.c"
+  "driver/level3/CMakeFiles/ssyrk_thread_UN.c"
+  "driver/level3/CMakeFiles/dsyrk_thread_UN.c"
+  "driver/level3/CMakeFiles/csyrk_thread_UN.c"
+  "driver/level3/CMakeFiles/zsyrk_thread_UN.c"
+  "driver/level3/CMakeFiles/ssyrk_thread_LN.c"
+  "driver/level3/CMakeFiles/dsyrk_thread_LN.c"
+  "driver/level3/CMakeFiles/csyrk_thread_LN.c"
+  "driver/level3/CMakeFiles/zsyrk_thread_LN.c"
+  "driver/level3/CMakeFiles/ssyrk_thread_UT.c"
+  "driver/level3/CMakeFiles/dsyrk_thread_UT.c"
+  "driver/level3/CMakeFiles/csyrk_thread_UT.c"
+  "driver/level3/CMakeFiles/zsyrk_thread_UT.c"
+  "driver/level3/CMakeFiles/ssyrk_thread_LT.c"
+  "driver/level3/CMakeFiles/dsyrk_thread_LT.c"
+  "driver/level3/CMakeFiles/csyrk_thread_LT.c"
+  "driver/level3/CMakeFiles/zsyrk_thread_LT.c"
+  "driver/level3/CMakeFiles/ssymm_thread_LU.c"
+  "driver/level3/CMakeFiles/dsymm_thread_LU.c"
+  "driver/level3/CMakeFiles/csymm_thread_LU.c"
+  "driver/level3/CMakeFiles/zsymm_thread_LU.c"
+  "driver/level3/CMakeFiles/ssymm_thread_RU.c"
+  "driver/level3/CMakeFiles/dsymm_thread_RU.c"
+  "driver/level3/CMakeFiles/csymm_thread_RU.c"
+  "driver/level3/CMakeFiles/zsymm_thread_RU.c"
+  "driver/level3/CMakeFiles/ssymm_thread_LL.c"
+  "driver/level3/CMakeFiles/dsymm_thread_LL.c"
+  "driver/level3/CMakeFiles/csymm_thread_LL.c"
+  "driver/level3/CMakeFiles/zsymm_thread_LL.c"
+  "driver/level3/CMakeFiles/ssymm_thread_RL.c"
+  "driver/level3/CMakeFiles/dsymm_thread_RL.c"
+  "driver/level3/CMakeFiles/csymm_thread_RL.c"
+  "driver/level3/CMakeFiles/zsymm_thread_RL.c"
+  "driver/level3/CMakeFiles/cherk_kernel_UN.c"
+  "driver/level3/CMakeFiles/cherk_kernel_LN.c"
+  "driver/level3/CMakeFiles/cherk_kernel_UC.c"
+  "driver/level3/CMakeFiles/cherk_kernel_LC.c"
+  "driver/level3/CMakeFiles/cherk_UN.c"
+  "driver/level3/CMakeFiles/cherk_LN.c"
+  "driver/level3/CMakeFiles/cherk_UC.c"
+  "driver/level3/CMakeFiles/cherk_LC.c"
+  "driver/level3/CMakeFiles/ctrmm_LRLN.c"
+  "driver/level3/CMakeFiles/ctrmm_LRUN.c"
+  "driver/level3/CMakeFiles/ctrmm_LRLU.c"
+  "driver/level3/CMakeFiles/ctrmm_LRUU.c"
+  "driver/level3/CMakeFiles/ctrmm_LCLN.c"
+  "driver/level3/CMakeFiles/ctrmm_LCUN.c"
+  "driver/level3/CMakeFiles/ctrmm_LCLU.c"
+  "driver/level3/CMakeFiles/ctrmm_LCUU.c"
+  "driver/level3/CMakeFiles/ctrmm_RRLN.c"
+  "driver/level3/CMakeFiles/ctrmm_RRUN.c"
+  "driver/level3/CMakeFiles/ctrmm_RRLU.c"
+  "driver/level3/CMakeFiles/ctrmm_RRUU.c"
+  "driver/level3/CMakeFiles/ctrmm_RCLN.c"
+  "driver/level3/CMakeFiles/ctrmm_RCUN.c"
+  "driver/level3/CMakeFiles/ctrmm_RCLU.c"
+  "driver/level3/CMakeFiles/ctrmm_RCUU.c"
+  "driver/level3/CMakeFiles/ctrsm_LRLN.c"
+  "driver/level3/CMakeFiles/ctrsm_LRUN.c"
+  "driver/level3/CMakeFiles/ctrsm_LRLU.c"
+  "driver/level3/CMakeFiles/ctrsm_LRUU.c"
+  "driver/level3/CMakeFiles/ctrsm_LCLN.c"
+  "driver/level3/CMakeFiles/ctrsm_LCUN.c"
+  "driver/level3/CMakeFiles/ctrsm_LCLU.c"
+  "driver/level3/CMakeFiles/ctrsm_LCUU.c"
+  "driver/level3/CMakeFiles/ctrsm_RRLN.c"
+  "driver/level3/CMakeFiles/ctrsm_RRUN.c"
+  "driver/level3/CMakeFiles/ctrsm_RRLU.c"
+  "driver/level3/CMakeFiles/ctrsm_RRUU.c"
+  "driver/level3/CMakeFiles/ctrsm_RCLN.c"
+  "driver/level3/CMakeFiles/ctrsm_RCUN.c"
+  "driver/level3/CMakeFiles/ctrsm_RCLU.c"
+  "driver/level3/CMakeFiles/ctrsm_RCUU.c"
+  "driver/level3/CMakeFiles/chemm_LU.c"
+  "driver/level3/CMakeFiles/chemm_LL.c"
+  "driver/level3/CMakeFiles/chemm_RU.c"
+  "driver/level3/CMakeFiles/chemm_RL.c"
+  "driver/level3/CMakeFiles/cher2k_kernel_UN.c"
+  "driver/level3/CMakeFiles/cher2k_kernel_LN.c"
+  "driver/level3/CMakeFiles/cher2k_kernel_UC.c"
+  "driver/level3/CMakeFiles/cher2k_kernel_LC.c"
+  "driver/level3/CMakeFiles/cher2k_UN.c"
+  "driver/level3/CMakeFiles/cher2k_UC.c"
+  "driver/level3/CMakeFiles/cher2k_LN.c"
+  "driver/level3/CMakeFiles/cher2k_LC.c"
+  "driver/level3/CMakeFiles/cherk_thread_UN.c"
+  "driver/level3/CMakeFiles/cherk_thread_LN.c"
+  "driver/level3/CMakeFiles/cherk_thread_UC.c"
+  "driver/level3/CMakeFiles/cherk_thread_LC.c"
+  "driver/level3/CMakeFiles/chemm_thread_LU.c"
+  "driver/level3/CMakeFiles/chemm_thread_LL.c"
+  "driver/level3/CMakeFiles/chemm_thread_RU.c"
+  "driver/level3/CMakeFiles/chemm_thread_RL.c"
+  "driver/level3/CMakeFiles/cher2k_UN.c"
+  "driver/level3/CMakeFiles/cher2k_UC.c"
+  "driver/level3/CMakeFiles/cher2k_LN.c"
+  "driver/level3/CMakeFiles/cher2k_LC.c"
+  "driver/level3/CMakeFiles/cgemm_rn.c"
+  "driver/level3/CMakeFiles/cgemm3m_rn.c"
+  "driver/level3/CMakeFiles/cgemm_thread_rn.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_rn.c"
+  "driver/level3/CMakeFiles/cgemm_cn.c"
+  "driver/level3/CMakeFiles/cgemm3m_cn.c"
+  "driver/level3/CMakeFiles/cgemm_thread_cn.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_cn.c"
+  "driver/level3/CMakeFiles/cgemm_rt.c"
+  "driver/level3/CMakeFiles/cgemm3m_rt.c"
+  "driver/level3/CMakeFiles/cgemm_thread_rt.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_rt.c"
+  "driver/level3/CMakeFiles/cgemm_ct.c"
+  "driver/level3/CMakeFiles/cgemm3m_ct.c"
+  "driver/level3/CMakeFiles/cgemm_thread_ct.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_ct.c"
+  "driver/level3/CMakeFiles/cgemm_nr.c"
+  "driver/level3/CMakeFiles/cgemm3m_nr.c"
+  "driver/level3/CMakeFiles/cgemm_thread_nr.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_nr.c"
+  "driver/level3/CMakeFiles/cgemm_tr.c"
+  "driver/level3/CMakeFiles/cgemm3m_tr.c"
+  "driver/level3/CMakeFiles/cgemm_thread_tr.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_tr.c"
+  "driver/level3/CMakeFiles/cgemm_rr.c"
+  "driver/level3/CMakeFiles/cgemm3m_rr.c"
+  "driver/level3/CMakeFiles/cgemm_thread_rr.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_rr.c"
+  "driver/level3/CMakeFiles/cgemm_cr.c"
+  "driver/level3/CMakeFiles/cgemm3m_cr.c"
+  "driver/level3/CMakeFiles/cgemm_thread_cr.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_cr.c"
+  "driver/level3/CMakeFiles/cgemm_nc.c"
+  "driver/level3/CMakeFiles/cgemm3m_nc.c"
+  "driver/level3/CMakeFiles/cgemm_thread_nc.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_nc.c"
+  "driver/level3/CMakeFiles/cgemm_tc.c"
+  "driver/level3/CMakeFiles/cgemm3m_tc.c"
+  "driver/level3/CMakeFiles/cgemm_thread_tc.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_tc.c"
+  "driver/level3/CMakeFiles/cgemm_rc.c"
+  "driver/level3/CMakeFiles/cgemm3m_rc.c"
+  "driver/level3/CMakeFiles/cgemm_thread_rc.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_rc.c"
+  "driver/level3/CMakeFiles/cgemm_cc.c"
+  "driver/level3/CMakeFiles/cgemm3m_cc.c"
+  "driver/level3/CMakeFiles/cgemm_thread_cc.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_cc.c"
+  "driver/level3/CMakeFiles/cgemm3m_nn.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_nn.c"
+  "driver/level3/CMakeFiles/cgemm3m_nt.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_nt.c"
+  "driver/level3/CMakeFiles/cgemm3m_tn.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_tn.c"
+  "driver/level3/CMakeFiles/cgemm3m_tt.c"
+  "driver/level3/CMakeFiles/cgemm3m_thread_tt.c"
+  "driver/level3/CMakeFiles/zherk_kernel_UN.c"
+  "driver/level3/CMakeFiles/zherk_kernel_LN.c"
+  "driver/level3/CMakeFiles/zherk_kernel_UC.c"
+  "driver/level3/CMakeFiles/zherk_kernel_LC.c"
+  "driver/level3/CMakeFiles/zherk_UN.c"
+  "driver/level3/CMakeFiles/zherk_LN.c"
+  "driver/level3/CMakeFiles/zherk_UC.c"
+  "driver/level3/CMakeFiles/zherk_LC.c"
+  "driver/level3/CMakeFiles/ztrmm_LRLN.c"
+  "driver/level3/CMakeFiles/ztrmm_LRUN.c"
+  "driver/level3/CMakeFiles/ztrmm_LRLU.c"
+  "driver/level3/CMakeFiles/ztrmm_LRUU.c"
+  "driver/level3/CMakeFiles/ztrmm_LCLN.c"
+  "driver/level3/CMakeFiles/ztrmm_LCUN.c"
+  "driver/level3/CMakeFiles/ztrmm_LCLU.c"
+  "driver/level3/CMakeFiles/ztrmm_LCUU.c"
+  "driver/level3/CMakeFiles/ztrmm_RRLN.c"
+  "driver/level3/CMakeFiles/ztrmm_RRUN.c"
+  "driver/level3/CMakeFiles/ztrmm_RRLU.c"
+  "driver/level3/CMakeFiles/ztrmm_RRUU.c"
+  "driver/level3/CMakeFiles/ztrmm_RCLN.c"
+  "driver/level3/CMakeFiles/ztrmm_RCUN.c"
+  "driver/level3/CMakeFiles/ztrmm_RCLU.c"
+  "driver/level3/CMakeFiles/ztrmm_RCUU.c"
+  "driver/level3/CMakeFiles/ztrsm_LRLN.c"
+  "driver/level3/CMakeFiles/ztrsm_LRUN.c"
+  "driver/level3/CMakeFiles/ztrsm_LRLU.c"
+  "driver/level3/CMakeFiles/ztrsm_LRUU.c"
+  "driver/level3/CMakeFiles/ztrsm_LCLN.c"
+  "driver/level3/CMakeFiles/ztrsm_LCUN.c"
+  "driver/level3/CMakeFiles/ztrsm_LCLU.c"
+  "driver/level3/CMakeFiles/ztrsm_LCUU.c"
+  "driver/level3/CMakeFiles/ztrsm_RRLN.c"
+  "driver/level3/CMakeFiles/ztrsm_RRUN.c"
+  "driver/level3/CMakeFiles/ztrsm_RRLU.c"
+  "driver/level3/CMakeFiles/ztrsm_RRUU.c"
+  "driver/level3/CMakeFiles/ztrsm_RCLN.c"
+  "driver/level3/CMakeFiles/ztrsm_RCUN.c"
+  "driver/level3/CMakeFiles/ztrsm_RCLU.c"
+  "driver/level3/CMakeFiles/ztrsm_RCUU.c"
+  "driver/level3/CMakeFiles/zhemm_LU.c"
+  "driver/level3/CMakeFiles/zhemm_LL.c"
+  "driver/level3/CMakeFiles/zhemm_RU.c"
+  "driver/level3/CMakeFiles/zhemm_RL.c"
+  "driver/level3/CMakeFiles/zher2k_kernel_UN.c"
+  "driver/level3/CMakeFiles/zher2k_kernel_LN.c"
+  "driver/level3/CMakeFiles/zher2k_kernel_UC.c"
+  "driver/level3/CMakeFiles/zher2k_kernel_LC.c"
+  "driver/level3/CMakeFiles/zher2k_UN.c"
+  "driver/level3/CMakeFiles/zher2k_UC.c"
+  "driver/level3/CMakeFiles/zher2k_LN.c"
+  "driver/level3/CMakeFiles/zher2k_LC.c"
+  "driver/level3/CMakeFiles/zherk_thread_UN.c"
+  "driver/level3/CMakeFiles/zherk_thread_LN.c"
+  "driver/level3/CMakeFiles/zherk_thread_UC.c"
+  "driver/level3/CMakeFiles/zherk_thread_LC.c"
+  "driver/level3/CMakeFiles/zhemm_thread_LU.c"
+  "driver/level3/CMakeFiles/zhemm_thread_LL.c"
+  "driver/level3/CMakeFiles/zhemm_thread_RU.c"
+  "driver/level3/CMakeFiles/zhemm_thread_RL.c"
+  "driver/level3/CMakeFiles/zher2k_UN.c"
+  "driver/level3/CMakeFiles/zher2k_UC.c"
+  "driver/level3/CMakeFiles/zher2k_LN.c"
+  "driver/level3/CMakeFiles/zher2k_LC.c"
+  "driver/level3/CMakeFiles/zgemm_rn.c"
+  "driver/level3/CMakeFiles/zgemm3m_rn.c"
+  "driver/level3/CMakeFiles/zgemm_thread_rn.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_rn.c"
+  "driver/level3/CMakeFiles/zgemm_cn.c"
+  "driver/level3/CMakeFiles/zgemm3m_cn.c"
+  "driver/level3/CMakeFiles/zgemm_thread_cn.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_cn.c"
+  "driver/level3/CMakeFiles/zgemm_rt.c"
+  "driver/level3/CMakeFiles/zgemm3m_rt.c"
+  "driver/level3/CMakeFiles/zgemm_thread_rt.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_rt.c"
+  "driver/level3/CMakeFiles/zgemm_ct.c"
+  "driver/level3/CMakeFiles/zgemm3m_ct.c"
+  "driver/level3/CMakeFiles/zgemm_thread_ct.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_ct.c"
+  "driver/level3/CMakeFiles/zgemm_nr.c"
+  "driver/level3/CMakeFiles/zgemm3m_nr.c"
+  "driver/level3/CMakeFiles/zgemm_thread_nr.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_nr.c"
+  "driver/level3/CMakeFiles/zgemm_tr.c"
+  "driver/level3/CMakeFiles/zgemm3m_tr.c"
+  "driver/level3/CMakeFiles/zgemm_thread_tr.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_tr.c"
+  "driver/level3/CMakeFiles/zgemm_rr.c"
+  "driver/level3/CMakeFiles/zgemm3m_rr.c"
+  "driver/level3/CMakeFiles/zgemm_thread_rr.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_rr.c"
+  "driver/level3/CMakeFiles/zgemm_cr.c"
+  "driver/level3/CMakeFiles/zgemm3m_cr.c"
+  "driver/level3/CMakeFiles/zgemm_thread_cr.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_cr.c"
+  "driver/level3/CMakeFiles/zgemm_nc.c"
+  "driver/level3/CMakeFiles/zgemm3m_nc.c"
+  "driver/level3/CMakeFiles/zgemm_thread_nc.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_nc.c"
+  "driver/level3/CMakeFiles/zgemm_tc.c"
+  "driver/level3/CMakeFiles/zgemm3m_tc.c"
+  "driver/level3/CMakeFiles/zgemm_thread_tc.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_tc.c"
+  "driver/level3/CMakeFiles/zgemm_rc.c"
+  "driver/level3/CMakeFiles/zgemm3m_rc.c"
+  "driver/level3/CMakeFiles/zgemm_thread_rc.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_rc.c"
+  "driver/level3/CMakeFiles/zgemm_cc.c"
+  "driver/level3/CMakeFiles/zgemm3m_cc.c"
+  "driver/level3/CMakeFiles/zgemm_thread_cc.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_cc.c"
+  "driver/level3/CMakeFiles/zgemm3m_nn.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_nn.c"
+  "driver/level3/CMakeFiles/zgemm3m_nt.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_nt.c"
+  "driver/level3/CMakeFiles/zgemm3m_tn.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_tn.c"
+  "driver/level3/CMakeFiles/zgemm3m_tt.c"
+  "driver/level3/CMakeFiles/zgemm3m_thread_tt.c"
+  "driver/level3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "driver/others/CMakeFiles/c_abs.c"
+  "driver/others/CMakeFiles/z_abs.c"
+  "driver/others/CMakeFiles/openblas_get_config.c"
+  "driver/others/CMakeFiles/openblas_get_parallel.c"
+  "driver/others/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "kernel/CMakeFiles/lsame.c"
+  "kernel/CMakeFiles/scabs1.c"
+  "kernel/CMakeFiles/dcabs1.c"
+  "kernel/CMakeFiles/samax_k.S"
+  "kernel/CMakeFiles/samin_k.S"
+  "kernel/CMakeFiles/smax_k.S"
+  "kernel/CMakeFiles/smin_k.S"
+  "kernel/CMakeFiles/isamax_k.S"
+  "kernel/CMakeFiles/isamin_k.S"
+  "kernel/CMakeFiles/ismax_k.S"
+  "kernel/CMakeFiles/ismin_k.S"
+  "kernel/CMakeFiles/sasum_k.c"
+  "kernel/CMakeFiles/saxpy_k.c"
+  "kernel/CMakeFiles/scopy_k.S"
+  "kernel/CMakeFiles/snrm2_k.S"
+  "kernel/CMakeFiles/srot_k.c"
+  "kernel/CMakeFiles/sscal_k.S"
+  "kernel/CMakeFiles/sswap_k.S"
+  "kernel/CMakeFiles/saxpby_k.c"
+  "kernel/CMakeFiles/ssum_k.c"
+  "kernel/CMakeFiles/sdot2_k.c"
+  "kernel/CMakeFiles/ssum2_k.c"
+  "kernel/CMakeFiles/sdot_k.c"
+  "kernel/CMakeFiles/damax_k.S"
+  "kernel/CMakeFiles/damin_k.S"
+  "kernel/CMakeFiles/dmax_k.S"
+  "kernel/CMakeFiles/dmin_k.S"
+  "kernel/CMakeFiles/idamax_k.S"
+  "kernel/CMakeFiles/idamin_k.S"
+  "kernel/CMakeFiles/idmax_k.S"
+  "kernel/CMakeFiles/idmin_k.S"
+  "kernel/CMakeFiles/dasum_k.c"
+  "kernel/CMakeFiles/daxpy_k.c"
+  "kernel/CMakeFiles/dcopy_k.S"
+  "kernel/CMakeFiles/dnrm2_k.S"
+  "kernel/CMakeFiles/drot_k.c"
+  "kernel/CMakeFiles/dscal_k.c"
+  "kernel/CMakeFiles/dswap_k.S"
+  "kernel/CMakeFiles/daxpby_k.c"
+  "kernel/CMakeFiles/dsum_k.c"
+  "kernel/CMakeFiles/ddot2_k.c"
+  "kernel/CMakeFiles/dsum2_k.c"
+  "kernel/CMakeFiles/ddot_k.c"
+  "kernel/CMakeFiles/camax_k.S"
+  "kernel/CMakeFiles/camin_k.S"
+  "kernel/CMakeFiles/icamax_k.S"
+  "kernel/CMakeFiles/icamin_k.S"
+  "kernel/CMakeFiles/casum_k.c"
+  "kernel/CMakeFiles/caxpy_k.c"
+  "kernel/CMakeFiles/ccopy_k.S"
+  "kernel/CMakeFiles/cnrm2_k.S"
+  "kernel/CMakeFiles/crot_k.S"
+  "kernel/CMakeFiles/cscal_k.c"
+  "kernel/CMakeFiles/cswap_k.S"
+  "kernel/CMakeFiles/caxpby_k.c"
+  "kernel/CMakeFiles/csum_k.S"
+  "kernel/CMakeFiles/caxpyc_k.c"
+  "kernel/CMakeFiles/cdotu_k.c"
+  "kernel/CMakeFiles/cdotc_k.c"
+  "kernel/CMakeFiles/csrot_k.S"
+  "kernel/CMakeFiles/zamax_k.S"
+  "kernel/CMakeFiles/zamin_k.S"
+  "kernel/CMakeFiles/izamax_k.S"
+  "kernel/CMakeFiles/izamin_k.S"
+  "kernel/CMakeFiles/zasum_k.c"
+  "kernel/CMakeFiles/zaxpy_k.c"
+  "kernel/CMakeFiles/zcopy_k.S"
+  "kernel/CMakeFiles/znrm2_k.S"
+  "kernel/CMakeFiles/zrot_k.S"
+  "kernel/CMakeFiles/zscal_k.c"
+  "kernel/CMakeFiles/zswap_k.S"
+  "kernel/CMakeFiles/zaxpby_k.c"
+  "kernel/CMakeFiles/zsum_k.S"
+  "kernel/CMakeFiles/zaxpyc_k.c"
+  "kernel/CMakeFiles/zdotu_k.c"
+  "kernel/CMakeFiles/zdotc_k.c"
+  "kernel/CMakeFiles/zdrot_k.S"
+  "kernel/CMakeFiles/dsdot_k.c"
+  "kernel/CMakeFiles/sdsdot_k.c"
+  "kernel/CMakeFiles/sbdot_k.c"
+  "kernel/CMakeFiles/sbf16tos_k.c"
+  "kernel/CMakeFiles/dbf16tod_k.c"
+  "kernel/CMakeFiles/sbstobf16_k.c"
+  "kernel/CMakeFiles/sbdtobf16_k.c"
+  "kernel/CMakeFiles/ssymv_U.c"
+  "kernel/CMakeFiles/dsymv_U.c"
+  "kernel/CMakeFiles/csymv_U.c"
+  "kernel/CMakeFiles/zsymv_U.c"
+  "kernel/CMakeFiles/ssymv_L.c"
+  "kernel/CMakeFiles/dsymv_L.c"
+  "kernel/CMakeFiles/csymv_L.c"
+  "kernel/CMakeFiles/zsymv_L.c"
+  "kernel/CMakeFiles/sger_k.c"
+  "kernel/CMakeFiles/dger_k.c"
+  "kernel/CMakeFiles/cger_k.c"
+  "kernel/CMakeFiles/zger_k.c"
+  "kernel/CMakeFiles/ssyr2v_U.c"
+  "kernel/CMakeFiles/ssyr2v_L.c"
+  "kernel/CMakeFiles/sgemvm_n.c"
+  "kernel/CMakeFiles/sgemvm_t.c"
+  "kernel/CMakeFiles/sgemv2_n.c"
+  "kernel/CMakeFiles/sgemv2_t.c"
+  "kernel/CMakeFiles/dsyr2v_U.c"
+  "kernel/CMakeFiles/dsyr2v_L.c"
+  "kernel/CMakeFiles/dgemvm_n.c"
+  "kernel/CMakeFiles/dgemvm_t.c"
+  "kernel/CMakeFiles/dgemv2_n.c"
+  "kernel/CMakeFiles/dgemv2_t.c"
+  "kernel/CMakeFiles/sgemv_n.c"
+  "kernel/CMakeFiles/sgemv_t.c"
+  "kernel/CMakeFiles/dgemv_n.c"
+  "kernel/CMakeFiles/dgemv_t.c"
+  "kernel/CMakeFiles/cgeru_k.c"
+  "kernel/CMakeFiles/cgerc_k.c"
+  "kernel/CMakeFiles/cgerv_k.c"
+  "kernel/CMakeFiles/cgerd_k.c"
+  "kernel/CMakeFiles/cgemv_n.c"
+  "kernel/CMakeFiles/cgemv_t.c"
+  "kernel/CMakeFiles/cgemv_r.c"
+  "kernel/CMakeFiles/cgemv_c.c"
+  "kernel/CMakeFiles/cgemv_o.c"
+  "kernel/CMakeFiles/cgemv_u.c"
+  "kernel/CMakeFiles/cgemv_s.c"
+  "kernel/CMakeFiles/cgemv_d.c"
+  "kernel/CMakeFiles/chemv_U.c"
+  "kernel/CMakeFiles/chemv_L.c"
+  "kernel/CMakeFiles/chemv_V.c"
+  "kernel/CMakeFiles/chemv_M.c"
+  "kernel/CMakeFiles/zgeru_k.c"
+  "kernel/CMakeFiles/zgerc_k.c"
+  "kernel/CMakeFiles/zgerv_k.c"
+  "kernel/CMakeFiles/zgerd_k.c"
+  "kernel/CMakeFiles/zgemv_n.c"
+  "kernel/CMakeFiles/zgemv_t.c"
+  "kernel/CMakeFiles/zgemv_r.c"
+  "kernel/CMakeFiles/zgemv_c.c"
+  "kernel/CMakeFiles/zgemv_o.c"
+  "kernel/CMakeFiles/zgemv_u.c"
+  "kernel/CMakeFiles/zgemv_s.c"
+  "kernel/CMakeFiles/zgemv_d.c"
+  "kernel/CMakeFiles/zhemv_U.S"
+  "kernel/CMakeFiles/zhemv_L.S"
+  "kernel/CMakeFiles/zhemv_V.c"
+  "kernel/CMakeFiles/zhemv_M.c"
+  "kernel/CMakeFiles/sbgemv_n.c"
+  "kernel/CMakeFiles/sbgemv_t.c"
+  "kernel/CMakeFiles/sgemm_direct.c"
+  "kernel/CMakeFiles/sgemm_direct_performant.c"
+  "kernel/CMakeFiles/sgemm_kernel.c"
+  "kernel/CMakeFiles/dgemm_kernel.c"
+  "kernel/CMakeFiles/sbgemm_incopy.c"
+  "kernel/CMakeFiles/sbgemm_itcopy.c"
+  "kernel/CMakeFiles/sbgemm_oncopy.c"
+  "kernel/CMakeFiles/sbgemm_otcopy.c"
+  "kernel/CMakeFiles/sbgemm_kernel.c"
+  "kernel/CMakeFiles/sbgemm_beta.c"
+  "kernel/CMakeFiles/sgemm_incopy.c"
+  "kernel/CMakeFiles/sgemm_itcopy.c"
+  "kernel/CMakeFiles/sgemm_oncopy.c"
+  "kernel/CMakeFiles/sgemm_otcopy.c"
+  "kernel/CMakeFiles/sgemm_beta.c"
+  "kernel/CMakeFiles/strmm_kernel_RN.c"
+  "kernel/CMakeFiles/strmm_kernel_LN.c"
+  "kernel/CMakeFiles/strmm_kernel_RT.c"
+  "kernel/CMakeFiles/strmm_kernel_LT.c"
+  "kernel/CMakeFiles/ssymm_outcopy.c"
+  "kernel/CMakeFiles/ssymm_iutcopy.c"
+  "kernel/CMakeFiles/ssymm_oltcopy.c"
+  "kernel/CMakeFiles/ssymm_iltcopy.c"
+  "kernel/CMakeFiles/strmm_iunucopy.c"
+  "kernel/CMakeFiles/strmm_iunncopy.c"
+  "kernel/CMakeFiles/strmm_ounucopy.c"
+  "kernel/CMakeFiles/strmm_ounncopy.c"
+  "kernel/CMakeFiles/strmm_ilnucopy.c"
+  "kernel/CMakeFiles/strmm_ilnncopy.c"
+  "kernel/CMakeFiles/strmm_olnucopy.c"
+  "kernel/CMakeFiles/strmm_olnncopy.c"
+  "kernel/CMakeFiles/strmm_iutucopy.c"
+  "kernel/CMakeFiles/strmm_iutncopy.c"
+  "kernel/CMakeFiles/strmm_outucopy.c"
+  "kernel/CMakeFiles/strmm_outncopy.c"
+  "kernel/CMakeFiles/strmm_iltucopy.c"
+  "kernel/CMakeFiles/strmm_iltncopy.c"
+  "kernel/CMakeFiles/strmm_oltucopy.c"
+  "kernel/CMakeFiles/strmm_oltncopy.c"
+  "kernel/CMakeFiles/strsm_iunucopy.c"
+  "kernel/CMakeFiles/strsm_iunncopy.c"
+  "kernel/CMakeFiles/strsm_ounucopy.c"
+  "kernel/CMakeFiles/strsm_ounncopy.c"
+  "kernel/CMakeFiles/strsm_ilnucopy.c"
+  "kernel/CMakeFiles/strsm_ilnncopy.c"
+  "kernel/CMakeFiles/strsm_olnucopy.c"
+  "kernel/CMakeFiles/strsm_olnncopy.c"
+  "kernel/CMakeFiles/strsm_iutucopy.c"
+  "kernel/CMakeFiles/strsm_iutncopy.c"
+  "kernel/CMakeFiles/strsm_outucopy.c"
+  "kernel/CMakeFiles/strsm_outncopy.c"
+  "kernel/CMakeFiles/strsm_iltucopy.c"
+  "kernel/CMakeFiles/strsm_iltncopy.c"
+  "kernel/CMakeFiles/strsm_oltucopy.c"
+  "kernel/CMakeFiles/strsm_oltncopy.c"
+  "kernel/CMakeFiles/strsm_kernel_LN.c"
+  "kernel/CMakeFiles/strsm_kernel_LT.c"
+  "kernel/CMakeFiles/strsm_kernel_RN.c"
+  "kernel/CMakeFiles/strsm_kernel_RT.c"
+  "kernel/CMakeFiles/sgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/sgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/somatcopy_k_cn.c"
+  "kernel/CMakeFiles/somatcopy_k_rn.c"
+  "kernel/CMakeFiles/somatcopy_k_ct.c"
+  "kernel/CMakeFiles/somatcopy_k_rt.c"
+  "kernel/CMakeFiles/simatcopy_k_cn.c"
+  "kernel/CMakeFiles/simatcopy_k_rn.c"
+  "kernel/CMakeFiles/simatcopy_k_ct.c"
+  "kernel/CMakeFiles/simatcopy_k_rt.c"
+  "kernel/CMakeFiles/sgeadd_k.c"
+  "kernel/CMakeFiles/dgemm_incopy.c"
+  "kernel/CMakeFiles/dgemm_itcopy.c"
+  "kernel/CMakeFiles/dgemm_oncopy.c"
+  "kernel/CMakeFiles/dgemm_otcopy.c"
+  "kernel/CMakeFiles/dgemm_beta.c"
+  "kernel/CMakeFiles/dtrmm_kernel_RN.c"
+  "kernel/CMakeFiles/dtrmm_kernel_LN.c"
+  "kernel/CMakeFiles/dtrmm_kernel_RT.c"
+  "kernel/CMakeFiles/dtrmm_kernel_LT.c"
+  "kernel/CMakeFiles/dsymm_outcopy.c"
+  "kernel/CMakeFiles/dsymm_iutcopy.c"
+  "kernel/CMakeFiles/dsymm_oltcopy.c"
+  "kernel/CMakeFiles/dsymm_iltcopy.c"
+  "kernel/CMakeFiles/dtrmm_iunucopy.c"
+  "kernel/CMakeFiles/dtrmm_iunncopy.c"
+  "kernel/CMakeFiles/dtrmm_ounucopy.c"
+  "kernel/CMakeFiles/dtrmm_ounncopy.c"
+  "kernel/CMakeFiles/dtrmm_ilnucopy.c"
+  "kernel/CMakeFiles/dtrmm_ilnncopy.c"
+  "kernel/CMakeFiles/dtrmm_olnucopy.c"
+  "kernel/CMakeFiles/dtrmm_olnncopy.c"
+  "kernel/CMakeFiles/dtrmm_iutucopy.c"
+  "kernel/CMakeFiles/dtrmm_iutncopy.c"
+  "kernel/CMakeFiles/dtrmm_outucopy.c"
+  "kernel/CMakeFiles/dtrmm_outncopy.c"
+  "kernel/CMakeFiles/dtrmm_iltucopy.c"
+  "kernel/CMakeFiles/dtrmm_iltncopy.c"
+  "kernel/CMakeFiles/dtrmm_oltucopy.c"
+  "kernel/CMakeFiles/dtrmm_oltncopy.c"
+  "kernel/CMakeFiles/dtrsm_iunucopy.c"
+  "kernel/CMakeFiles/dtrsm_iunncopy.c"
+  "kernel/CMakeFiles/dtrsm_ounucopy.c"
+  "kernel/CMakeFiles/dtrsm_ounncopy.c"
+  "kernel/CMakeFiles/dtrsm_ilnucopy.c"
+  "kernel/CMakeFiles/dtrsm_ilnncopy.c"
+  "kernel/CMakeFiles/dtrsm_olnucopy.c"
+  "kernel/CMakeFiles/dtrsm_olnncopy.c"
+  "kernel/CMakeFiles/dtrsm_iutucopy.c"
+  "kernel/CMakeFiles/dtrsm_iutncopy.c"
+  "kernel/CMakeFiles/dtrsm_outucopy.c"
+  "kernel/CMakeFiles/dtrsm_outncopy.c"
+  "kernel/CMakeFiles/dtrsm_iltucopy.c"
+  "kernel/CMakeFiles/dtrsm_iltncopy.c"
+  "kernel/CMakeFiles/dtrsm_oltucopy.c"
+  "kernel/CMakeFiles/dtrsm_oltncopy.c"
+  "kernel/CMakeFiles/dtrsm_kernel_LN.c"
+  "kernel/CMakeFiles/dtrsm_kernel_LT.c"
+  "kernel/CMakeFiles/dtrsm_kernel_RN.c"
+  "kernel/CMakeFiles/dtrsm_kernel_RT.c"
+  "kernel/CMakeFiles/dgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/dgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/domatcopy_k_cn.c"
+  "kernel/CMakeFiles/domatcopy_k_rn.c"
+  "kernel/CMakeFiles/domatcopy_k_ct.c"
+  "kernel/CMakeFiles/domatcopy_k_rt.c"
+  "kernel/CMakeFiles/dimatcopy_k_cn.c"
+  "kernel/CMakeFiles/dimatcopy_k_rn.c"
+  "kernel/CMakeFiles/dimatcopy_k_ct.c"
+  "kernel/CMakeFiles/dimatcopy_k_rt.c"
+  "kernel/CMakeFiles/dgeadd_k.c"
+  "kernel/CMakeFiles/cgemm_incopy.c"
+  "kernel/CMakeFiles/cgemm_itcopy.c"
+  "kernel/CMakeFiles/cgemm_oncopy.c"
+  "kernel/CMakeFiles/cgemm_otcopy.c"
+  "kernel/CMakeFiles/cgemm_beta.S"
+  "kernel/CMakeFiles/cgemm_kernel_n.c"
+  "kernel/CMakeFiles/cgemm_kernel_l.c"
+  "kernel/CMakeFiles/cgemm_kernel_r.c"
+  "kernel/CMakeFiles/cgemm_kernel_b.c"
+  "kernel/CMakeFiles/ctrmm_kernel_LN.S"
+  "kernel/CMakeFiles/ctrmm_kernel_LT.S"
+  "kernel/CMakeFiles/ctrmm_kernel_LR.S"
+  "kernel/CMakeFiles/ctrmm_kernel_LC.S"
+  "kernel/CMakeFiles/ctrmm_kernel_RN.S"
+  "kernel/CMakeFiles/ctrmm_kernel_RT.S"
+  "kernel/CMakeFiles/ctrmm_kernel_RR.S"
+  "kernel/CMakeFiles/ctrmm_kernel_RC.S"
+  "kernel/CMakeFiles/ctrsm_kernel_LR.c"
+  "kernel/CMakeFiles/ctrsm_kernel_LC.c"
+  "kernel/CMakeFiles/ctrsm_kernel_RR.c"
+  "kernel/CMakeFiles/ctrsm_kernel_RC.c"
+  "kernel/CMakeFiles/chemm_iutcopy.c"
+  "kernel/CMakeFiles/chemm_iltcopy.c"
+  "kernel/CMakeFiles/chemm_outcopy.c"
+  "kernel/CMakeFiles/chemm_oltcopy.c"
+  "kernel/CMakeFiles/csymm_outcopy.c"
+  "kernel/CMakeFiles/csymm_iutcopy.c"
+  "kernel/CMakeFiles/csymm_oltcopy.c"
+  "kernel/CMakeFiles/csymm_iltcopy.c"
+  "kernel/CMakeFiles/ctrmm_iunucopy.c"
+  "kernel/CMakeFiles/ctrmm_iunncopy.c"
+  "kernel/CMakeFiles/ctrmm_ounucopy.c"
+  "kernel/CMakeFiles/ctrmm_ounncopy.c"
+  "kernel/CMakeFiles/ctrmm_ilnucopy.c"
+  "kernel/CMakeFiles/ctrmm_ilnncopy.c"
+  "kernel/CMakeFiles/ctrmm_olnucopy.c"
+  "kernel/CMakeFiles/ctrmm_olnncopy.c"
+  "kernel/CMakeFiles/ctrmm_iutucopy.c"
+  "kernel/CMakeFiles/ctrmm_iutncopy.c"
+  "kernel/CMakeFiles/ctrmm_outucopy.c"
+  "kernel/CMakeFiles/ctrmm_outncopy.c"
+  "kernel/CMakeFiles/ctrmm_iltucopy.c"
+  "kernel/CMakeFiles/ctrmm_iltncopy.c"
+  "kernel/CMakeFiles/ctrmm_oltucopy.c"
+  "kernel/CMakeFiles/ctrmm_oltncopy.c"
+  "kernel/CMakeFiles/ctrsm_iunucopy.c"
+  "kernel/CMakeFiles/ctrsm_iunncopy.c"
+  "kernel/CMakeFiles/ctrsm_ounucopy.c"
+  "kernel/CMakeFiles/ctrsm_ounncopy.c"
+  "kernel/CMakeFiles/ctrsm_ilnucopy.c"
+  "kernel/CMakeFiles/ctrsm_ilnncopy.c"
+  "kernel/CMakeFiles/ctrsm_olnucopy.c"
+  "kernel/CMakeFiles/ctrsm_olnncopy.c"
+  "kernel/CMakeFiles/ctrsm_iutucopy.c"
+  "kernel/CMakeFiles/ctrsm_iutncopy.c"
+  "kernel/CMakeFiles/ctrsm_outucopy.c"
+  "kernel/CMakeFiles/ctrsm_outncopy.c"
+  "kernel/CMakeFiles/ctrsm_iltucopy.c"
+  "kernel/CMakeFiles/ctrsm_iltncopy.c"
+  "kernel/CMakeFiles/ctrsm_oltucopy.c"
+  "kernel/CMakeFiles/ctrsm_oltncopy.c"
+  "kernel/CMakeFiles/cgemm3m_kernel.c"
+  "kernel/CMakeFiles/cgemm3m_oncopyb.c"
+  "kernel/CMakeFiles/cgemm3m_oncopyr.c"
+  "kernel/CMakeFiles/cgemm3m_oncopyi.c"
+  "kernel/CMakeFiles/cgemm3m_otcopyb.c"
+  "kernel/CMakeFiles/cgemm3m_otcopyr.c"
+  "kernel/CMakeFiles/cgemm3m_otcopyi.c"
+  "kernel/CMakeFiles/cgemm3m_incopyb.c"
+  "kernel/CMakeFiles/cgemm3m_incopyr.c"
+  "kernel/CMakeFiles/cgemm3m_incopyi.c"
+  "kernel/CMakeFiles/cgemm3m_itcopyb.c"
+  "kernel/CMakeFiles/cgemm3m_itcopyr.c"
+  "kernel/CMakeFiles/cgemm3m_itcopyi.c"
+  "kernel/CMakeFiles/csymm3m_oucopyb.c"
+  "kernel/CMakeFiles/csymm3m_oucopyr.c"
+  "kernel/CMakeFiles/csymm3m_oucopyi.c"
+  "kernel/CMakeFiles/csymm3m_olcopyb.c"
+  "kernel/CMakeFiles/csymm3m_olcopyr.c"
+  "kernel/CMakeFiles/csymm3m_olcopyi.c"
+  "kernel/CMakeFiles/csymm3m_iucopyb.c"
+  "kernel/CMakeFiles/csymm3m_iucopyr.c"
+  "kernel/CMakeFiles/csymm3m_iucopyi.c"
+  "kernel/CMakeFiles/csymm3m_ilcopyb.c"
+  "kernel/CMakeFiles/csymm3m_ilcopyr.c"
+  "kernel/CMakeFiles/csymm3m_ilcopyi.c"
+  "kernel/CMakeFiles/chemm3m_oucopyb.c"
+  "kernel/CMakeFiles/chemm3m_oucopyr.c"
+  "kernel/CMakeFiles/chemm3m_oucopyi.c"
+  "kernel/CMakeFiles/chemm3m_olcopyb.c"
+  "kernel/CMakeFiles/chemm3m_olcopyr.c"
+  "kernel/CMakeFiles/chemm3m_olcopyi.c"
+  "kernel/CMakeFiles/chemm3m_iucopyb.c"
+  "kernel/CMakeFiles/chemm3m_iucopyr.c"
+  "kernel/CMakeFiles/chemm3m_iucopyi.c"
+  "kernel/CMakeFiles/chemm3m_ilcopyb.c"
+  "kernel/CMakeFiles/chemm3m_ilcopyr.c"
+  "kernel/CMakeFiles/chemm3m_ilcopyi.c"
+  "kernel/CMakeFiles/ctrsm_kernel_LN.c"
+  "kernel/CMakeFiles/ctrsm_kernel_LT.c"
+  "kernel/CMakeFiles/ctrsm_kernel_RN.c"
+  "kernel/CMakeFiles/ctrsm_kernel_RT.c"
+  "kernel/CMakeFiles/cgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_nr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_rn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_rr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_nc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_rt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_rc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_tr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_cn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_cr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_tc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_ct.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_cc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_nr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_rn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_rr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_nc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_rt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_rc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_tr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_cn.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_cr.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_tc.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_ct.c"
+  "kernel/CMakeFiles/cgemm_small_kernel_b0_cc.c"
+  "kernel/CMakeFiles/sbgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/comatcopy_k_cn.c"
+  "kernel/CMakeFiles/comatcopy_k_rn.c"
+  "kernel/CMakeFiles/comatcopy_k_ct.c"
+  "kernel/CMakeFiles/comatcopy_k_rt.c"
+  "kernel/CMakeFiles/comatcopy_k_cnc.c"
+  "kernel/CMakeFiles/comatcopy_k_rnc.c"
+  "kernel/CMakeFiles/comatcopy_k_ctc.c"
+  "kernel/CMakeFiles/comatcopy_k_rtc.c"
+  "kernel/CMakeFiles/cimatcopy_k_cn.c"
+  "kernel/CMakeFiles/cimatcopy_k_rn.c"
+  "kernel/CMakeFiles/cimatcopy_k_ct.c"
+  "kernel/CMakeFiles/cimatcopy_k_rt.c"
+  "kernel/CMakeFiles/cimatcopy_k_cnc.c"
+  "kernel/CMakeFiles/cimatcopy_k_rnc.c"
+  "kernel/CMakeFiles/cimatcopy_k_ctc.c"
+  "kernel/CMakeFiles/cimatcopy_k_rtc.c"
+  "kernel/CMakeFiles/cgeadd_k.c"
+  "kernel/CMakeFiles/zgemm_incopy.c"
+  "kernel/CMakeFiles/zgemm_itcopy.c"
+  "kernel/CMakeFiles/zgemm_oncopy.c"
+  "kernel/CMakeFiles/zgemm_otcopy.c"
+  "kernel/CMakeFiles/zgemm_beta.S"
+  "kernel/CMakeFiles/zgemm_kernel_n.c"
+  "kernel/CMakeFiles/zgemm_kernel_l.c"
+  "kernel/CMakeFiles/zgemm_kernel_r.c"
+  "kernel/CMakeFiles/zgemm_kernel_b.c"
+  "kernel/CMakeFiles/ztrmm_kernel_LN.S"
+  "kernel/CMakeFiles/ztrmm_kernel_LT.S"
+  "kernel/CMakeFiles/ztrmm_kernel_LR.S"
+  "kernel/CMakeFiles/ztrmm_kernel_LC.S"
+  "kernel/CMakeFiles/ztrmm_kernel_RN.S"
+  "kernel/CMakeFiles/ztrmm_kernel_RT.S"
+  "kernel/CMakeFiles/ztrmm_kernel_RR.S"
+  "kernel/CMakeFiles/ztrmm_kernel_RC.S"
+  "kernel/CMakeFiles/ztrsm_kernel_LR.c"
+  "kernel/CMakeFiles/ztrsm_kernel_LC.c"
+  "kernel/CMakeFiles/ztrsm_kernel_RR.c"
+  "kernel/CMakeFiles/ztrsm_kernel_RC.c"
+  "kernel/CMakeFiles/zhemm_iutcopy.c"
+  "kernel/CMakeFiles/zhemm_iltcopy.c"
+  "kernel/CMakeFiles/zhemm_outcopy.c"
+  "kernel/CMakeFiles/zhemm_oltcopy.c"
+  "kernel/CMakeFiles/zsymm_outcopy.c"
+  "kernel/CMakeFiles/zsymm_iutcopy.c"
+  "kernel/CMakeFiles/zsymm_oltcopy.c"
+  "kernel/CMakeFiles/zsymm_iltcopy.c"
+  "kernel/CMakeFiles/ztrmm_iunucopy.c"
+  "kernel/CMakeFiles/ztrmm_iunncopy.c"
+  "kernel/CMakeFiles/ztrmm_ounucopy.c"
+  "kernel/CMakeFiles/ztrmm_ounncopy.c"
+  "kernel/CMakeFiles/ztrmm_ilnucopy.c"
+  "kernel/CMakeFiles/ztrmm_ilnncopy.c"
+  "kernel/CMakeFiles/ztrmm_olnucopy.c"
+  "kernel/CMakeFiles/ztrmm_olnncopy.c"
+  "kernel/CMakeFiles/ztrmm_iutucopy.c"
+  "kernel/CMakeFiles/ztrmm_iutncopy.c"
+  "kernel/CMakeFiles/ztrmm_outucopy.c"
+  "kernel/CMakeFiles/ztrmm_outncopy.c"
+  "kernel/CMakeFiles/ztrmm_iltucopy.c"
+  "kernel/CMakeFiles/ztrmm_iltncopy.c"
+  "kernel/CMakeFiles/ztrmm_oltucopy.c"
+  "kernel/CMakeFiles/ztrmm_oltncopy.c"
+  "kernel/CMakeFiles/ztrsm_iunucopy.c"
+  "kernel/CMakeFiles/ztrsm_iunncopy.c"
+  "kernel/CMakeFiles/ztrsm_ounucopy.c"
+  "kernel/CMakeFiles/ztrsm_ounncopy.c"
+  "kernel/CMakeFiles/ztrsm_ilnucopy.c"
+  "kernel/CMakeFiles/ztrsm_ilnncopy.c"
+  "kernel/CMakeFiles/ztrsm_olnucopy.c"
+  "kernel/CMakeFiles/ztrsm_olnncopy.c"
+  "kernel/CMakeFiles/ztrsm_iutucopy.c"
+  "kernel/CMakeFiles/ztrsm_iutncopy.c"
+  "kernel/CMakeFiles/ztrsm_outucopy.c"
+  "kernel/CMakeFiles/ztrsm_outncopy.c"
+  "kernel/CMakeFiles/ztrsm_iltucopy.c"
+  "kernel/CMakeFiles/ztrsm_iltncopy.c"
+  "kernel/CMakeFiles/ztrsm_oltucopy.c"
+  "kernel/CMakeFiles/ztrsm_oltncopy.c"
+  "kernel/CMakeFiles/zgemm3m_kernel.c"
+  "kernel/CMakeFiles/zgemm3m_oncopyb.c"
+  "kernel/CMakeFiles/zgemm3m_oncopyr.c"
+  "kernel/CMakeFiles/zgemm3m_oncopyi.c"
+  "kernel/CMakeFiles/zgemm3m_otcopyb.c"
+  "kernel/CMakeFiles/zgemm3m_otcopyr.c"
+  "kernel/CMakeFiles/zgemm3m_otcopyi.c"
+  "kernel/CMakeFiles/zgemm3m_incopyb.c"
+  "kernel/CMakeFiles/zgemm3m_incopyr.c"
+  "kernel/CMakeFiles/zgemm3m_incopyi.c"
+  "kernel/CMakeFiles/zgemm3m_itcopyb.c"
+  "kernel/CMakeFiles/zgemm3m_itcopyr.c"
+  "kernel/CMakeFiles/zgemm3m_itcopyi.c"
+  "kernel/CMakeFiles/zsymm3m_oucopyb.c"
+  "kernel/CMakeFiles/zsymm3m_oucopyr.c"
+  "kernel/CMakeFiles/zsymm3m_oucopyi.c"
+  "kernel/CMakeFiles/zsymm3m_olcopyb.c"
+  "kernel/CMakeFiles/zsymm3m_olcopyr.c"
+  "kernel/CMakeFiles/zsymm3m_olcopyi.c"
+  "kernel/CMakeFiles/zsymm3m_iucopyb.c"
+  "kernel/CMakeFiles/zsymm3m_iucopyr.c"
+  "kernel/CMakeFiles/zsymm3m_iucopyi.c"
+  "kernel/CMakeFiles/zsymm3m_ilcopyb.c"
+  "kernel/CMakeFiles/zsymm3m_ilcopyr.c"
+  "kernel/CMakeFiles/zsymm3m_ilcopyi.c"
+  "kernel/CMakeFiles/zhemm3m_oucopyb.c"
+  "kernel/CMakeFiles/zhemm3m_oucopyr.c"
+  "kernel/CMakeFiles/zhemm3m_oucopyi.c"
+  "kernel/CMakeFiles/zhemm3m_olcopyb.c"
+  "kernel/CMakeFiles/zhemm3m_olcopyr.c"
+  "kernel/CMakeFiles/zhemm3m_olcopyi.c"
+  "kernel/CMakeFiles/zhemm3m_iucopyb.c"
+  "kernel/CMakeFiles/zhemm3m_iucopyr.c"
+  "kernel/CMakeFiles/zhemm3m_iucopyi.c"
+  "kernel/CMakeFiles/zhemm3m_ilcopyb.c"
+  "kernel/CMakeFiles/zhemm3m_ilcopyr.c"
+  "kernel/CMakeFiles/zhemm3m_ilcopyi.c"
+  "kernel/CMakeFiles/ztrsm_kernel_LN.c"
+  "kernel/CMakeFiles/ztrsm_kernel_LT.c"
+  "kernel/CMakeFiles/ztrsm_kernel_RN.c"
+  "kernel/CMakeFiles/ztrsm_kernel_RT.c"
+  "kernel/CMakeFiles/zgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_nr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_rn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_rr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_nc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_rt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_rc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_tr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_cn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_cr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_tc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_ct.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_cc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_nr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_rn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_rr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_nc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_rt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_rc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_tr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_cn.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_cr.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_tc.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_ct.c"
+  "kernel/CMakeFiles/zgemm_small_kernel_b0_cc.c"
+  "kernel/CMakeFiles/sbgemm_small_matrix_permit.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_tt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_nt.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tn.c"
+  "kernel/CMakeFiles/sbgemm_small_kernel_b0_tt.c"
+  "kernel/CMakeFiles/zomatcopy_k_cn.c"
+  "kernel/CMakeFiles/zomatcopy_k_rn.c"
+  "kernel/CMakeFiles/zomatcopy_k_ct.c"
+  "kernel/CMakeFiles/zomatcopy_k_rt.c"
+  "kernel/CMakeFiles/zomatcopy_k_cnc.c"
+  "kernel/CMakeFiles/zomatcopy_k_rnc.c"
+  "kernel/CMakeFiles/zomatcopy_k_ctc.c"
+  "kernel/CMakeFiles/zomatcopy_k_rtc.c"
+  "kernel/CMakeFiles/zimatcopy_k_cn.c"
+  "kernel/CMakeFiles/zimatcopy_k_rn.c"
+  "kernel/CMakeFiles/zimatcopy_k_ct.c"
+  "kernel/CMakeFiles/zimatcopy_k_rt.c"
+  "kernel/CMakeFiles/zimatcopy_k_cnc.c"
+  "kernel/CMakeFiles/zimatcopy_k_rnc.c"
+  "kernel/CMakeFiles/zimatcopy_k_ctc.c"
+  "kernel/CMakeFiles/zimatcopy_k_rtc.c"
+  "kernel/CMakeFiles/zgeadd_k.c"
+  "kernel/CMakeFiles/sneg_tcopy.c"
+  "kernel/CMakeFiles/slaswp_ncopy.c"
+  "kernel/CMakeFiles/dneg_tcopy.c"
+  "kernel/CMakeFiles/dlaswp_ncopy.c"
+  "kernel/CMakeFiles/cneg_tcopy.c"
+  "kernel/CMakeFiles/claswp_ncopy.c"
+  "kernel/CMakeFiles/zneg_tcopy.c"
+  "kernel/CMakeFiles/zlaswp_ncopy.c"
+  "kernel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lapack/CMakeFiles/spotrf_U_single.c"
+  "lapack/CMakeFiles/spotrf_L_single.c"
+  "lapack/CMakeFiles/slauum_U_single.c"
+  "lapack/CMakeFiles/slauum_L_single.c"
+  "lapack/CMakeFiles/dpotrf_U_single.c"
+  "lapack/CMakeFiles/dpotrf_L_single.c"
+  "lapack/CMakeFiles/dlauum_U_single.c"
+  "lapack/CMakeFiles/dlauum_L_single.c"
+  "lapack/CMakeFiles/cpotrf_U_single.c"
+  "lapack/CMakeFiles/cpotrf_L_single.c"
+  "lapack/CMakeFiles/clauum_U_single.c"
+  "lapack/CMakeFiles/clauum_L_single.c"
+  "lapack/CMakeFiles/zpotrf_U_single.c"
+  "lapack/CMakeFiles/zpotrf_L_single.c"
+  "lapack/CMakeFiles/zlauum_U_single.c"
+  "lapack/CMakeFiles/zlauum_L_single.c"
+  "lapack/CMakeFiles/sgetf2_k.c"
+  "lapack/CMakeFiles/slauu2_U.c"
+  "lapack/CMakeFiles/slauu2_L.c"
+  "lapack/CMakeFiles/spotf2_U.c"
+  "lapack/CMakeFiles/spotf2_L.c"
+  "lapack/CMakeFiles/dgetf2_k.c"
+  "lapack/CMakeFiles/dlauu2_U.c"
+  "lapack/CMakeFiles/dlauu2_L.c"
+  "lapack/CMakeFiles/dpotf2_U.c"
+  "lapack/CMakeFiles/dpotf2_L.c"
+  "lapack/CMakeFiles/cgetf2_k.c"
+  "lapack/CMakeFiles/clauu2_U.c"
+  "lapack/CMakeFiles/clauu2_L.c"
+  "lapack/CMakeFiles/cpotf2_U.c"
+  "lapack/CMakeFiles/cpotf2_L.c"
+  "lapack/CMakeFiles/zgetf2_k.c"
+  "lapack/CMakeFiles/zlauu2_U.c"
+  "lapack/CMakeFiles/zlauu2_L.c"
+  "lapack/CMakeFiles/zpotf2_U.c"
+  "lapack/CMakeFiles/zpotf2_L.c"
+  "lapack/CMakeFiles/slaswp_plus.c"
+  "lapack/CMakeFiles/dlaswp_plus.c"
+  "lapack/CMakeFiles/claswp_plus.c"
+  "lapack/CMakeFiles/zlaswp_plus.c"
+  "lapack/CMakeFiles/slaswp_minus.c"
+  "lapack/CMakeFiles/dlaswp_minus.c"
+  "lapack/CMakeFiles/claswp_minus.c"
+  "lapack/CMakeFiles/zlaswp_minus.c"
+  "lapack/CMakeFiles/sgetrf_single.c"
+  "lapack/CMakeFiles/dgetrf_single.c"
+  "lapack/CMakeFiles/cgetrf_single.c"
+  "lapack/CMakeFiles/zgetrf_single.c"
+  "lapack/CMakeFiles/sgeqrf_single.c"
+  "lapack/CMakeFiles/dgeqrf_single.c"
+  "lapack/CMakeFiles/sgetrf_parallel.c"
+  "lapack/CMakeFiles/dgetrf_parallel.c"
+  "lapack/CMakeFiles/cgetrf_parallel.c"
+  "lapack/CMakeFiles/zgetrf_parallel.c"
+  "lapack/CMakeFiles/slauum_U_parallel.c"
+  "lapack/CMakeFiles/slauum_L_parallel.c"
+  "lapack/CMakeFiles/spotrf_U_parallel.c"
+  "lapack/CMakeFiles/spotrf_L_parallel.c"
+  "lapack/CMakeFiles/dlauum_U_parallel.c"
+  "lapack/CMakeFiles/dlauum_L_parallel.c"
+  "lapack/CMakeFiles/dpotrf_U_parallel.c"
+  "lapack/CMakeFiles/dpotrf_L_parallel.c"
+  "lapack/CMakeFiles/clauum_U_parallel.c"
+  "lapack/CMakeFiles/clauum_L_parallel.c"
+  "lapack/CMakeFiles/cpotrf_U_parallel.c"
+  "lapack/CMakeFiles/cpotrf_L_parallel.c"
+  "lapack/CMakeFiles/zlauum_U_parallel.c"
+  "lapack/CMakeFiles/zlauum_L_parallel.c"
+  "lapack/CMakeFiles/zpotrf_U_parallel.c"
+  "lapack/CMakeFiles/zpotrf_L_parallel.c"
+  "lapack/CMakeFiles/sgeqrf_parallel.c"
+  "lapack/CMakeFiles/dgeqrf_parallel.c"
+  "lapack/CMakeFiles/sgetrs_N_single.c"
+  "lapack/CMakeFiles/sgetrs_N_parallel.c"
+  "lapack/CMakeFiles/sgetrs_T_single.c"
+  "lapack/CMakeFiles/sgetrs_T_parallel.c"
+  "lapack/CMakeFiles/dgetrs_N_single.c"
+  "lapack/CMakeFiles/dgetrs_N_parallel.c"
+  "lapack/CMakeFiles/dgetrs_T_single.c"
+  "lapack/CMakeFiles/dgetrs_T_parallel.c"
+  "lapack/CMakeFiles/cgetrs_N_single.c"
+  "lapack/CMakeFiles/cgetrs_T_single.c"
+  "lapack/CMakeFiles/cgetrs_R_single.c"
+  "lapack/CMakeFiles/cgetrs_C_single.c"
+  "lapack/CMakeFiles/cgetrs_N_parallel.c"
+  "lapack/CMakeFiles/cgetrs_T_parallel.c"
+  "lapack/CMakeFiles/cgetrs_R_parallel.c"
+  "lapack/CMakeFiles/cgetrs_C_parallel.c"
+  "lapack/CMakeFiles/zgetrs_N_single.c"
+  "lapack/CMakeFiles/zgetrs_T_single.c"
+  "lapack/CMakeFiles/zgetrs_R_single.c"
+  "lapack/CMakeFiles/zgetrs_C_single.c"
+  "lapack/CMakeFiles/zgetrs_N_parallel.c"
+  "lapack/CMakeFiles/zgetrs_T_parallel.c"
+  "lapack/CMakeFiles/zgetrs_R_parallel.c"
+  "lapack/CMakeFiles/zgetrs_C_parallel.c"
+  "lapack/CMakeFiles/strtri_UN_single.c"
+  "lapack/CMakeFiles/dtrtri_UN_single.c"
+  "lapack/CMakeFiles/ctrtri_UN_single.c"
+  "lapack/CMakeFiles/ztrtri_UN_single.c"
+  "lapack/CMakeFiles/strtri_LN_single.c"
+  "lapack/CMakeFiles/dtrtri_LN_single.c"
+  "lapack/CMakeFiles/ctrtri_LN_single.c"
+  "lapack/CMakeFiles/ztrtri_LN_single.c"
+  "lapack/CMakeFiles/strtri_UN_parallel.c"
+  "lapack/CMakeFiles/dtrtri_UN_parallel.c"
+  "lapack/CMakeFiles/ctrtri_UN_parallel.c"
+  "lapack/CMakeFiles/ztrtri_UN_parallel.c"
+  "lapack/CMakeFiles/strtri_LN_parallel.c"
+  "lapack/CMakeFiles/dtrtri_LN_parallel.c"
+  "lapack/CMakeFiles/ctrtri_LN_parallel.c"
+  "lapack/CMakeFiles/ztrtri_LN_parallel.c"
+  "lapack/CMakeFiles/strtri_UU_single.c"
+  "lapack/CMakeFiles/dtrtri_UU_single.c"
+  "lapack/CMakeFiles/ctrtri_UU_single.c"
+  "lapack/CMakeFiles/ztrtri_UU_single.c"
+  "lapack/CMakeFiles/strtri_LU_single.c"
+  "lapack/CMakeFiles/dtrtri_LU_single.c"
+  "lapack/CMakeFiles/ctrtri_LU_single.c"
+  "lapack/CMakeFiles/ztrtri_LU_single.c"
+  "lapack/CMakeFiles/strtri_UU_parallel.c"
+  "lapack/CMakeFiles/dtrtri_UU_parallel.c"
+  "lapack/CMakeFiles/ctrtri_UU_parallel.c"
+  "lapack/CMakeFiles/ztrtri_UU_parallel.c"
+  "lapack/CMakeFiles/strtri_LU_parallel.c"
+  "lapack/CMakeFiles/dtrtri_LU_parallel.c"
+  "lapack/CMakeFiles/ctrtri_LU_parallel.c"
+  "lapack/CMakeFiles/ztrtri_LU_parallel.c"
+  "lapack/CMakeFiles/strti2_UN.c"
+  "lapack/CMakeFiles/dtrti2_UN.c"
+  "lapack/CMakeFiles/ctrti2_UN.c"
+  "lapack/CMakeFiles/ztrti2_UN.c"
+  "lapack/CMakeFiles/strti2_LN.c"
+  "lapack/CMakeFiles/dtrti2_LN.c"
+  "lapack/CMakeFiles/ctrti2_LN.c"
+  "lapack/CMakeFiles/ztrti2_LN.c"
+  "lapack/CMakeFiles/strti2_UU.c"
+  "lapack/CMakeFiles/dtrti2_UU.c"
+  "lapack/CMakeFiles/ctrti2_UU.c"
+  "lapack/CMakeFiles/ztrti2_UU.c"
+  "lapack/CMakeFiles/strti2_LU.c"
+  "lapack/CMakeFiles/dtrti2_LU.c"
+  "lapack/CMakeFiles/ctrti2_LU.c"
+  "lapack/CMakeFiles/ztrti2_LU.c"
+  "lapack/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lapack-netlib/TESTING/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lapack-netlib/TESTING/EIG/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/LAPACK_OVERRIDES.dir/DependInfo.cmake"
+  "CMakeFiles/LAPACKE.dir/DependInfo.cmake"
+  "CMakeFiles/openblas_static.dir/DependInfo.cmake"
+  "CMakeFiles/genlapacke.dir/DependInfo.cmake"
+  "interface/CMakeFiles/interface.dir/DependInfo.cmake"
+  "driver/level2/CMakeFiles/driver_level2.dir/DependInfo.cmake"
+  "driver/level3/CMakeFiles/driver_level3.dir/DependInfo.cmake"
+  "driver/others/CMakeFiles/driver_others.dir/DependInfo.cmake"
+  "kernel/CMakeFiles/kernel.dir/DependInfo.cmake"
+  "lapack/CMakeFiles/lapack.dir/DependInfo.cmake"
+  "utest/CMakeFiles/openblas_utest.dir/DependInfo.cmake"
+  "test/CMakeFiles/sblat1.dir/DependInfo.cmake"
+  "test/CMakeFiles/sblat2.dir/DependInfo.cmake"
+  "test/CMakeFiles/sblat3.dir/DependInfo.cmake"
+  "test/CMakeFiles/dblat1.dir/DependInfo.cmake"
+  "test/CMakeFiles/dblat2.dir/DependInfo.cmake"
+  "test/CMakeFiles/dblat3.dir/DependInfo.cmake"
+  "test/CMakeFiles/cblat1.dir/DependInfo.cmake"
+  "test/CMakeFiles/cblat2.dir/DependInfo.cmake"
+  "test/CMakeFiles/cblat3.dir/DependInfo.cmake"
+  "test/CMakeFiles/zblat1.dir/DependInfo.cmake"
+  "test/CMakeFiles/zblat2.dir/DependInfo.cmake"
+  "test/CMakeFiles/zblat3.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintsts.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstrfs.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstd.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstrfd.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstds.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstc.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstrfc.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstz.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstrfz.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/LIN/CMakeFiles/xlintstzc.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/EIG/CMakeFiles/xeigtsts.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/EIG/CMakeFiles/xeigtstc.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/EIG/CMakeFiles/xeigtstd.dir/DependInfo.cmake"
+  "lapack-netlib/TESTING/EIG/CMakeFiles/xeigtstz.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xscblat1.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xscblat2.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xscblat3.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xdcblat1.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xdcblat2.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xdcblat3.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xccblat1.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xccblat2.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xccblat3.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xzcblat1.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xzcblat2.dir/DependInfo.cmake"
+  "ctest/CMakeFiles/xzcblat3.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_smp_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("interface")
+subdirs("driver/level2")
+subdirs("driver/level3")
+subdirs("driver/others")
+subdirs("kernel")
+subdirs("lapack")
+subdirs("utest")
+subdirs("test")
+subdirs("lapack-netlib/TESTING")
+subdirs("ctest")
@@ -0,0 +1,3 @@
+#include <immintrin.h>
+
+int main(void){ __asm__ volatile("vbroadcastss -4 * 4(%rsi), %zmm2"); }
\ No newline at end of file
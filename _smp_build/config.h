@@ -0,0 +1,36 @@
+#define OS_LINUX	1
+#define ARCH_X86_64	1
+#define C_GCC	1
+#define __64BIT__	1
+#define FUNDERSCORE	
+#define BUNDERSCORE _
+#define NEEDBUNDERSCORE 1
+#define NEED2UNDERSCORES 0
+#define COOPERLAKE
+#define L1_DATA_SIZE 32768
+#define L1_DATA_LINESIZE 64
+#define L2_SIZE 262144
+#define L2_LINESIZE 64
+#define DTB_DEFAULT_ENTRIES 64
+#define DTB_SIZE 4096
+#define HAVE_CMOV
+#define HAVE_MMX
+#define HAVE_SSE
+#define HAVE_SSE2
+#define HAVE_SSE3
+#define HAVE_SSSE3
+#define HAVE_SSE4_1
+#define HAVE_SSE4_2
+#define HAVE_AVX
+#define HAVE_AVX2
+#define HAVE_FMA3
+#define FMA3
+#define HAVE_AVX512VL
+#define HAVE_AVX512BF16
+#define CORE_COOPERLAKE
+#define CHAR_CORENAME "COOPERLAKE"
+#define SLOCAL_BUFFER_SIZE	20480
+#define DLOCAL_BUFFER_SIZE	12288
+#define CLOCAL_BUFFER_SIZE	12288
+#define ZLOCAL_BUFFER_SIZE	8192
+#define GEMM_MULTITHREAD_THRESHOLD	4
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xccblat1.dir/c_cblas1.c.o"
+  "CMakeFiles/xccblat1.dir/c_cblas1.c.o.d"
+  "CMakeFiles/xccblat1.dir/c_cblat1.f.o"
+  "xccblat1"
+  "xccblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xccblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xccblat2.dir/auxiliary.c.o"
+  "CMakeFiles/xccblat2.dir/auxiliary.c.o.d"
+  "CMakeFiles/xccblat2.dir/c_c2chke.c.o"
+  "CMakeFiles/xccblat2.dir/c_c2chke.c.o.d"
+  "CMakeFiles/xccblat2.dir/c_cblas2.c.o"
+  "CMakeFiles/xccblat2.dir/c_cblas2.c.o.d"
+  "CMakeFiles/xccblat2.dir/c_cblat2.f.o"
+  "CMakeFiles/xccblat2.dir/c_xerbla.c.o"
+  "CMakeFiles/xccblat2.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xccblat2.dir/constant.c.o"
+  "CMakeFiles/xccblat2.dir/constant.c.o.d"
+  "xccblat2"
+  "xccblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xccblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
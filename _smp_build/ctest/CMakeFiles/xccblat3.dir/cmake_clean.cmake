@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xccblat3.dir/auxiliary.c.o"
+  "CMakeFiles/xccblat3.dir/auxiliary.c.o.d"
+  "CMakeFiles/xccblat3.dir/c_c3chke.c.o"
+  "CMakeFiles/xccblat3.dir/c_c3chke.c.o.d"
+  "CMakeFiles/xccblat3.dir/c_cblas3.c.o"
+  "CMakeFiles/xccblat3.dir/c_cblas3.c.o.d"
+  "CMakeFiles/xccblat3.dir/c_cblat3.f.o"
+  "CMakeFiles/xccblat3.dir/c_xerbla.c.o"
+  "CMakeFiles/xccblat3.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xccblat3.dir/constant.c.o"
+  "CMakeFiles/xccblat3.dir/constant.c.o.d"
+  "xccblat3"
+  "xccblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xccblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xdcblat1.dir/c_dblas1.c.o"
+  "CMakeFiles/xdcblat1.dir/c_dblas1.c.o.d"
+  "CMakeFiles/xdcblat1.dir/c_dblat1.f.o"
+  "xdcblat1"
+  "xdcblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xdcblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xdcblat2.dir/auxiliary.c.o"
+  "CMakeFiles/xdcblat2.dir/auxiliary.c.o.d"
+  "CMakeFiles/xdcblat2.dir/c_d2chke.c.o"
+  "CMakeFiles/xdcblat2.dir/c_d2chke.c.o.d"
+  "CMakeFiles/xdcblat2.dir/c_dblas2.c.o"
+  "CMakeFiles/xdcblat2.dir/c_dblas2.c.o.d"
+  "CMakeFiles/xdcblat2.dir/c_dblat2.f.o"
+  "CMakeFiles/xdcblat2.dir/c_xerbla.c.o"
+  "CMakeFiles/xdcblat2.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xdcblat2.dir/constant.c.o"
+  "CMakeFiles/xdcblat2.dir/constant.c.o.d"
+  "xdcblat2"
+  "xdcblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xdcblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
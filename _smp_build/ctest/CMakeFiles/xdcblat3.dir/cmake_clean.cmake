@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xdcblat3.dir/auxiliary.c.o"
+  "CMakeFiles/xdcblat3.dir/auxiliary.c.o.d"
+  "CMakeFiles/xdcblat3.dir/c_d3chke.c.o"
+  "CMakeFiles/xdcblat3.dir/c_d3chke.c.o.d"
+  "CMakeFiles/xdcblat3.dir/c_dblas3.c.o"
+  "CMakeFiles/xdcblat3.dir/c_dblas3.c.o.d"
+  "CMakeFiles/xdcblat3.dir/c_dblat3.f.o"
+  "CMakeFiles/xdcblat3.dir/c_xerbla.c.o"
+  "CMakeFiles/xdcblat3.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xdcblat3.dir/constant.c.o"
+  "CMakeFiles/xdcblat3.dir/constant.c.o.d"
+  "xdcblat3"
+  "xdcblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xdcblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
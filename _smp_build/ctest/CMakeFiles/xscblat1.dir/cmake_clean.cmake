@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xscblat1.dir/c_sblas1.c.o"
+  "CMakeFiles/xscblat1.dir/c_sblas1.c.o.d"
+  "CMakeFiles/xscblat1.dir/c_sblat1.f.o"
+  "xscblat1"
+  "xscblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xscblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xscblat2.dir/auxiliary.c.o"
+  "CMakeFiles/xscblat2.dir/auxiliary.c.o.d"
+  "CMakeFiles/xscblat2.dir/c_s2chke.c.o"
+  "CMakeFiles/xscblat2.dir/c_s2chke.c.o.d"
+  "CMakeFiles/xscblat2.dir/c_sblas2.c.o"
+  "CMakeFiles/xscblat2.dir/c_sblas2.c.o.d"
+  "CMakeFiles/xscblat2.dir/c_sblat2.f.o"
+  "CMakeFiles/xscblat2.dir/c_xerbla.c.o"
+  "CMakeFiles/xscblat2.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xscblat2.dir/constant.c.o"
+  "CMakeFiles/xscblat2.dir/constant.c.o.d"
+  "xscblat2"
+  "xscblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xscblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/root/repo/ctest/c_sblat3.f" "/root/repo/_smp_build/ctest/CMakeFiles/xscblat3.dir/c_sblat3.f.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  "/root/repo/lapack-netlib/LAPACKE/include"
+  "/root/repo"
+  "."
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ctest/auxiliary.c" "ctest/CMakeFiles/xscblat3.dir/auxiliary.c.o" "gcc" "ctest/CMakeFiles/xscblat3.dir/auxiliary.c.o.d"
+  "/root/repo/ctest/c_s3chke.c" "ctest/CMakeFiles/xscblat3.dir/c_s3chke.c.o" "gcc" "ctest/CMakeFiles/xscblat3.dir/c_s3chke.c.o.d"
+  "/root/repo/ctest/c_sblas3.c" "ctest/CMakeFiles/xscblat3.dir/c_sblas3.c.o" "gcc" "ctest/CMakeFiles/xscblat3.dir/c_sblas3.c.o.d"
+  "/root/repo/ctest/c_xerbla.c" "ctest/CMakeFiles/xscblat3.dir/c_xerbla.c.o" "gcc" "ctest/CMakeFiles/xscblat3.dir/c_xerbla.c.o.d"
+  "/root/repo/ctest/constant.c" "ctest/CMakeFiles/xscblat3.dir/constant.c.o" "gcc" "ctest/CMakeFiles/xscblat3.dir/constant.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_smp_build/CMakeFiles/openblas_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
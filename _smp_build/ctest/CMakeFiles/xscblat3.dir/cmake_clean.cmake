@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xscblat3.dir/auxiliary.c.o"
+  "CMakeFiles/xscblat3.dir/auxiliary.c.o.d"
+  "CMakeFiles/xscblat3.dir/c_s3chke.c.o"
+  "CMakeFiles/xscblat3.dir/c_s3chke.c.o.d"
+  "CMakeFiles/xscblat3.dir/c_sblas3.c.o"
+  "CMakeFiles/xscblat3.dir/c_sblas3.c.o.d"
+  "CMakeFiles/xscblat3.dir/c_sblat3.f.o"
+  "CMakeFiles/xscblat3.dir/c_xerbla.c.o"
+  "CMakeFiles/xscblat3.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xscblat3.dir/constant.c.o"
+  "CMakeFiles/xscblat3.dir/constant.c.o.d"
+  "xscblat3"
+  "xscblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xscblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
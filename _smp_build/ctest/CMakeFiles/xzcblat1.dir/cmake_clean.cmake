@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xzcblat1.dir/c_zblas1.c.o"
+  "CMakeFiles/xzcblat1.dir/c_zblas1.c.o.d"
+  "CMakeFiles/xzcblat1.dir/c_zblat1.f.o"
+  "xzcblat1"
+  "xzcblat1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xzcblat1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
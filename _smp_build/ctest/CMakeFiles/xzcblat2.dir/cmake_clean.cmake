@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xzcblat2.dir/auxiliary.c.o"
+  "CMakeFiles/xzcblat2.dir/auxiliary.c.o.d"
+  "CMakeFiles/xzcblat2.dir/c_xerbla.c.o"
+  "CMakeFiles/xzcblat2.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xzcblat2.dir/c_z2chke.c.o"
+  "CMakeFiles/xzcblat2.dir/c_z2chke.c.o.d"
+  "CMakeFiles/xzcblat2.dir/c_zblas2.c.o"
+  "CMakeFiles/xzcblat2.dir/c_zblas2.c.o.d"
+  "CMakeFiles/xzcblat2.dir/c_zblat2.f.o"
+  "CMakeFiles/xzcblat2.dir/constant.c.o"
+  "CMakeFiles/xzcblat2.dir/constant.c.o.d"
+  "xzcblat2"
+  "xzcblat2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xzcblat2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
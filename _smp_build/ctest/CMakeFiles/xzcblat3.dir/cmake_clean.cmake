@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xzcblat3.dir/auxiliary.c.o"
+  "CMakeFiles/xzcblat3.dir/auxiliary.c.o.d"
+  "CMakeFiles/xzcblat3.dir/c_xerbla.c.o"
+  "CMakeFiles/xzcblat3.dir/c_xerbla.c.o.d"
+  "CMakeFiles/xzcblat3.dir/c_z3chke.c.o"
+  "CMakeFiles/xzcblat3.dir/c_z3chke.c.o.d"
+  "CMakeFiles/xzcblat3.dir/c_zblas3.c.o"
+  "CMakeFiles/xzcblat3.dir/c_zblas3.c.o.d"
+  "CMakeFiles/xzcblat3.dir/c_zblat3.f.o"
+  "CMakeFiles/xzcblat3.dir/constant.c.o"
+  "CMakeFiles/xzcblat3.dir/constant.c.o.d"
+  "xzcblat3"
+  "xzcblat3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/xzcblat3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
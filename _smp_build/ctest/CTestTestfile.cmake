@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ctest
+# Build directory: /root/repo/_smp_build/ctest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(xscblat1 "/root/repo/_smp_build/ctest/xscblat1")
+set_tests_properties(xscblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;46;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xscblat2 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xscblat2" "/root/repo/ctest/sin2")
+set_tests_properties(xscblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;71;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xscblat3 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xscblat3" "/root/repo/ctest/sin3")
+set_tests_properties(xscblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;96;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xdcblat1 "/root/repo/_smp_build/ctest/xdcblat1")
+set_tests_properties(xdcblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;46;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xdcblat2 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xdcblat2" "/root/repo/ctest/din2")
+set_tests_properties(xdcblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;71;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xdcblat3 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xdcblat3" "/root/repo/ctest/din3")
+set_tests_properties(xdcblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;96;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xccblat1 "/root/repo/_smp_build/ctest/xccblat1")
+set_tests_properties(xccblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;46;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xccblat2 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xccblat2" "/root/repo/ctest/cin2")
+set_tests_properties(xccblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;71;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xccblat3 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xccblat3" "/root/repo/ctest/cin3")
+set_tests_properties(xccblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;96;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xzcblat1 "/root/repo/_smp_build/ctest/xzcblat1")
+set_tests_properties(xzcblat1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;46;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xzcblat2 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xzcblat2" "/root/repo/ctest/zin2")
+set_tests_properties(xzcblat2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;71;add_test;/root/repo/ctest/CMakeLists.txt;0;")
+add_test(xzcblat3 "sh" "/root/repo/_smp_build/ctest/test_cblas_helper.sh" "/root/repo/_smp_build/ctest/xzcblat3" "/root/repo/ctest/zin3")
+set_tests_properties(xzcblat3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ctest/CMakeLists.txt;96;add_test;/root/repo/ctest/CMakeLists.txt;0;")
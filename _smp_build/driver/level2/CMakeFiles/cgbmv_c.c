@@ -0,0 +1,10 @@
+#define TRANS
+#define CONJ
+#define ASMNAME cgbmv_c
+#define ASMFNAME cgbmv_c_
+#define NAME cgbmv_c_
+#define CNAME cgbmv_c
+#define CHAR_NAME "cgbmv_c_"
+#define CHAR_CNAME "cgbmv_c"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define TRANS
+#define CONJ
+#define XCONJ
+#define ASMNAME cgbmv_d
+#define ASMFNAME cgbmv_d_
+#define NAME cgbmv_d_
+#define CNAME cgbmv_d
+#define CHAR_NAME "cgbmv_d_"
+#define CHAR_CNAME "cgbmv_d"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME cgbmv_n
+#define ASMFNAME cgbmv_n_
+#define NAME cgbmv_n_
+#define CNAME cgbmv_n
+#define CHAR_NAME "cgbmv_n_"
+#define CHAR_CNAME "cgbmv_n"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
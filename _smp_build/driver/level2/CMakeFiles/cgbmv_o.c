@@ -0,0 +1,9 @@
+#define XCONJ
+#define ASMNAME cgbmv_o
+#define ASMFNAME cgbmv_o_
+#define NAME cgbmv_o_
+#define CNAME cgbmv_o
+#define CHAR_NAME "cgbmv_o_"
+#define CHAR_CNAME "cgbmv_o"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
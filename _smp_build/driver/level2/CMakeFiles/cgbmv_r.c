@@ -0,0 +1,9 @@
+#define CONJ
+#define ASMNAME cgbmv_r
+#define ASMFNAME cgbmv_r_
+#define NAME cgbmv_r_
+#define CNAME cgbmv_r
+#define CHAR_NAME "cgbmv_r_"
+#define CHAR_CNAME "cgbmv_r"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
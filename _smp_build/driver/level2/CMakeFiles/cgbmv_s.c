@@ -0,0 +1,10 @@
+#define CONJ
+#define XCONJ
+#define ASMNAME cgbmv_s
+#define ASMFNAME cgbmv_s_
+#define NAME cgbmv_s_
+#define CNAME cgbmv_s
+#define CHAR_NAME "cgbmv_s_"
+#define CHAR_CNAME "cgbmv_s"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
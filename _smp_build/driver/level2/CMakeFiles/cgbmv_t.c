@@ -0,0 +1,9 @@
+#define TRANS
+#define ASMNAME cgbmv_t
+#define ASMFNAME cgbmv_t_
+#define NAME cgbmv_t_
+#define CNAME cgbmv_t
+#define CHAR_NAME "cgbmv_t_"
+#define CHAR_CNAME "cgbmv_t"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
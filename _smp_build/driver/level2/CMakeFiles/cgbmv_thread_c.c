@@ -0,0 +1,10 @@
+#define CONJ
+#define TRANSA
+#define ASMNAME cgbmv_thread_c
+#define ASMFNAME cgbmv_thread_c_
+#define NAME cgbmv_thread_c_
+#define CNAME cgbmv_thread_c
+#define CHAR_NAME "cgbmv_thread_c_"
+#define CHAR_CNAME "cgbmv_thread_c"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define XCONJ
+#define CONJ
+#define TRANSA
+#define ASMNAME cgbmv_thread_d
+#define ASMFNAME cgbmv_thread_d_
+#define NAME cgbmv_thread_d_
+#define CNAME cgbmv_thread_d
+#define CHAR_NAME "cgbmv_thread_d_"
+#define CHAR_CNAME "cgbmv_thread_d"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
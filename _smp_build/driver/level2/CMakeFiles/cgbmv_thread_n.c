@@ -0,0 +1,8 @@
+#define ASMNAME cgbmv_thread_n
+#define ASMFNAME cgbmv_thread_n_
+#define NAME cgbmv_thread_n_
+#define CNAME cgbmv_thread_n
+#define CHAR_NAME "cgbmv_thread_n_"
+#define CHAR_CNAME "cgbmv_thread_n"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define XCONJ
+#define ASMNAME cgbmv_thread_o
+#define ASMFNAME cgbmv_thread_o_
+#define NAME cgbmv_thread_o_
+#define CNAME cgbmv_thread_o
+#define CHAR_NAME "cgbmv_thread_o_"
+#define CHAR_CNAME "cgbmv_thread_o"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
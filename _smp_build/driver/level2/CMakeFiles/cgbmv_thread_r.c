@@ -0,0 +1,9 @@
+#define CONJ
+#define ASMNAME cgbmv_thread_r
+#define ASMFNAME cgbmv_thread_r_
+#define NAME cgbmv_thread_r_
+#define CNAME cgbmv_thread_r
+#define CHAR_NAME "cgbmv_thread_r_"
+#define CHAR_CNAME "cgbmv_thread_r"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
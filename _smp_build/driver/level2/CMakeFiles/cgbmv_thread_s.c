@@ -0,0 +1,10 @@
+#define XCONJ
+#define CONJ
+#define ASMNAME cgbmv_thread_s
+#define ASMFNAME cgbmv_thread_s_
+#define NAME cgbmv_thread_s_
+#define CNAME cgbmv_thread_s
+#define CHAR_NAME "cgbmv_thread_s_"
+#define CHAR_CNAME "cgbmv_thread_s"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA
+#define ASMNAME cgbmv_thread_t
+#define ASMFNAME cgbmv_thread_t_
+#define NAME cgbmv_thread_t_
+#define CNAME cgbmv_thread_t
+#define CHAR_NAME "cgbmv_thread_t_"
+#define CHAR_CNAME "cgbmv_thread_t"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define XCONJ
+#define TRANSA
+#define ASMNAME cgbmv_thread_u
+#define ASMFNAME cgbmv_thread_u_
+#define NAME cgbmv_thread_u_
+#define CNAME cgbmv_thread_u
+#define CHAR_NAME "cgbmv_thread_u_"
+#define CHAR_CNAME "cgbmv_thread_u"
+#define COMPLEX
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
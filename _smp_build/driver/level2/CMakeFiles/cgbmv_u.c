@@ -0,0 +1,10 @@
+#define TRANS
+#define XCONJ
+#define ASMNAME cgbmv_u
+#define ASMFNAME cgbmv_u_
+#define NAME cgbmv_u_
+#define CNAME cgbmv_u
+#define CHAR_NAME "cgbmv_u_"
+#define CHAR_CNAME "cgbmv_u"
+#define COMPLEX
+#include "/root/repo/driver/level2/zgbmv_k.c"
\ No newline at end of file
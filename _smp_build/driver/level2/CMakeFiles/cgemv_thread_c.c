@@ -0,0 +1,10 @@
+#define CONJ
+#define TRANSA
+#define ASMNAME cgemv_thread_c
+#define ASMFNAME cgemv_thread_c_
+#define NAME cgemv_thread_c_
+#define CNAME cgemv_thread_c
+#define CHAR_NAME "cgemv_thread_c_"
+#define CHAR_CNAME "cgemv_thread_c"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
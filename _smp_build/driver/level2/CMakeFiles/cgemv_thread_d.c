@@ -0,0 +1,11 @@
+#define XCONJ
+#define CONJ
+#define TRANSA
+#define ASMNAME cgemv_thread_d
+#define ASMFNAME cgemv_thread_d_
+#define NAME cgemv_thread_d_
+#define CNAME cgemv_thread_d
+#define CHAR_NAME "cgemv_thread_d_"
+#define CHAR_CNAME "cgemv_thread_d"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
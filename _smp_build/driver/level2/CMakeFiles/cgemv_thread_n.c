@@ -0,0 +1,8 @@
+#define ASMNAME cgemv_thread_n
+#define ASMFNAME cgemv_thread_n_
+#define NAME cgemv_thread_n_
+#define CNAME cgemv_thread_n
+#define CHAR_NAME "cgemv_thread_n_"
+#define CHAR_CNAME "cgemv_thread_n"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
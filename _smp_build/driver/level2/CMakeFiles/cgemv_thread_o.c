@@ -0,0 +1,9 @@
+#define XCONJ
+#define ASMNAME cgemv_thread_o
+#define ASMFNAME cgemv_thread_o_
+#define NAME cgemv_thread_o_
+#define CNAME cgemv_thread_o
+#define CHAR_NAME "cgemv_thread_o_"
+#define CHAR_CNAME "cgemv_thread_o"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
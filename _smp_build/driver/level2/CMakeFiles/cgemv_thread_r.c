@@ -0,0 +1,9 @@
+#define CONJ
+#define ASMNAME cgemv_thread_r
+#define ASMFNAME cgemv_thread_r_
+#define NAME cgemv_thread_r_
+#define CNAME cgemv_thread_r
+#define CHAR_NAME "cgemv_thread_r_"
+#define CHAR_CNAME "cgemv_thread_r"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
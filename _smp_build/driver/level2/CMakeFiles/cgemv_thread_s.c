@@ -0,0 +1,10 @@
+#define XCONJ
+#define CONJ
+#define ASMNAME cgemv_thread_s
+#define ASMFNAME cgemv_thread_s_
+#define NAME cgemv_thread_s_
+#define CNAME cgemv_thread_s
+#define CHAR_NAME "cgemv_thread_s_"
+#define CHAR_CNAME "cgemv_thread_s"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
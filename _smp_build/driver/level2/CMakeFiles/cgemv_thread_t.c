@@ -0,0 +1,9 @@
+#define TRANSA
+#define ASMNAME cgemv_thread_t
+#define ASMFNAME cgemv_thread_t_
+#define NAME cgemv_thread_t_
+#define CNAME cgemv_thread_t
+#define CHAR_NAME "cgemv_thread_t_"
+#define CHAR_CNAME "cgemv_thread_t"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
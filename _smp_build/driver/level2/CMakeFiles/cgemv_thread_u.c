@@ -0,0 +1,10 @@
+#define XCONJ
+#define TRANSA
+#define ASMNAME cgemv_thread_u
+#define ASMFNAME cgemv_thread_u_
+#define NAME cgemv_thread_u_
+#define CNAME cgemv_thread_u
+#define CHAR_NAME "cgemv_thread_u_"
+#define CHAR_CNAME "cgemv_thread_u"
+#define COMPLEX
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define CONJ
+#define ASMNAME cger_thread_C
+#define ASMFNAME cger_thread_C_
+#define NAME cger_thread_C_
+#define CNAME cger_thread_C
+#define CHAR_NAME "cger_thread_C_"
+#define CHAR_CNAME "cger_thread_C"
+#define COMPLEX
+#include "/root/repo/driver/level2/ger_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define XCONJ
+#define CONJ
+#define ASMNAME cger_thread_D
+#define ASMFNAME cger_thread_D_
+#define NAME cger_thread_D_
+#define CNAME cger_thread_D
+#define CHAR_NAME "cger_thread_D_"
+#define CHAR_CNAME "cger_thread_D"
+#define COMPLEX
+#include "/root/repo/driver/level2/ger_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME cger_thread_U
+#define ASMFNAME cger_thread_U_
+#define NAME cger_thread_U_
+#define CNAME cger_thread_U
+#define CHAR_NAME "cger_thread_U_"
+#define CHAR_CNAME "cger_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/ger_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define XCONJ
+#define ASMNAME cger_thread_V
+#define ASMFNAME cger_thread_V_
+#define NAME cger_thread_V_
+#define CNAME cger_thread_V
+#define CHAR_NAME "cger_thread_V_"
+#define CHAR_CNAME "cger_thread_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/ger_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME chbmv_L
+#define ASMFNAME chbmv_L_
+#define NAME chbmv_L_
+#define CNAME chbmv_L
+#define CHAR_NAME "chbmv_L_"
+#define CHAR_CNAME "chbmv_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define HEMVREV
+#define ASMNAME chbmv_M
+#define ASMFNAME chbmv_M_
+#define NAME chbmv_M_
+#define CNAME chbmv_M
+#define CHAR_NAME "chbmv_M_"
+#define CHAR_CNAME "chbmv_M"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhbmv_k.c"
\ No newline at end of file
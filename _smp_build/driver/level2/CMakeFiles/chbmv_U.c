@@ -0,0 +1,8 @@
+#define ASMNAME chbmv_U
+#define ASMFNAME chbmv_U_
+#define NAME chbmv_U_
+#define CNAME chbmv_U
+#define CHAR_NAME "chbmv_U_"
+#define CHAR_CNAME "chbmv_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chbmv_V
+#define ASMFNAME chbmv_V_
+#define NAME chbmv_V_
+#define CNAME chbmv_V
+#define CHAR_NAME "chbmv_V_"
+#define CHAR_CNAME "chbmv_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhbmv_k.c"
\ No newline at end of file
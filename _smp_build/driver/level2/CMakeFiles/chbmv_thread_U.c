@@ -0,0 +1,9 @@
+#define HEMV
+#define ASMNAME chbmv_thread_U
+#define ASMFNAME chbmv_thread_U_
+#define NAME chbmv_thread_U_
+#define CNAME chbmv_thread_U
+#define CHAR_NAME "chbmv_thread_U_"
+#define CHAR_CNAME "chbmv_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/sbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chbmv_thread_V
+#define ASMFNAME chbmv_thread_V_
+#define NAME chbmv_thread_V_
+#define CNAME chbmv_thread_V
+#define CHAR_NAME "chbmv_thread_V_"
+#define CHAR_CNAME "chbmv_thread_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/sbmv_thread.c"
\ No newline at end of file
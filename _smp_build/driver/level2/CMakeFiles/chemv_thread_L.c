@@ -0,0 +1,10 @@
+#define HEMV
+#define LOWER
+#define ASMNAME chemv_thread_L
+#define ASMFNAME chemv_thread_L_
+#define NAME chemv_thread_L_
+#define CNAME chemv_thread_L
+#define CHAR_NAME "chemv_thread_L_"
+#define CHAR_CNAME "chemv_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/symv_thread.c"
\ No newline at end of file
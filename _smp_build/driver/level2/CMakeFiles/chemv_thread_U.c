@@ -0,0 +1,9 @@
+#define HEMV
+#define ASMNAME chemv_thread_U
+#define ASMFNAME chemv_thread_U_
+#define NAME chemv_thread_U_
+#define CNAME chemv_thread_U
+#define CHAR_NAME "chemv_thread_U_"
+#define CHAR_CNAME "chemv_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/symv_thread.c"
\ No newline at end of file
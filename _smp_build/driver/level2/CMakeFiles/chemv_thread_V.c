@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chemv_thread_V
+#define ASMFNAME chemv_thread_V_
+#define NAME chemv_thread_V_
+#define CNAME chemv_thread_V
+#define CHAR_NAME "chemv_thread_V_"
+#define CHAR_CNAME "chemv_thread_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/symv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME cher2_V
+#define ASMFNAME cher2_V_
+#define NAME cher2_V_
+#define CNAME cher2_V
+#define CHAR_NAME "cher2_V_"
+#define CHAR_CNAME "cher2_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/zher2_k.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define HERREV
+#define ASMNAME cher2_thread_M
+#define ASMFNAME cher2_thread_M_
+#define NAME cher2_thread_M_
+#define CNAME cher2_thread_M
+#define CHAR_NAME "cher2_thread_M_"
+#define CHAR_CNAME "cher2_thread_M"
+#define COMPLEX
+#include "/root/repo/driver/level2/syr2_thread.c"
\ No newline at end of file
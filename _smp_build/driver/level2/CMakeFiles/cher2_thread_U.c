@@ -0,0 +1,9 @@
+#define HER
+#define ASMNAME cher2_thread_U
+#define ASMFNAME cher2_thread_U_
+#define NAME cher2_thread_U_
+#define CNAME cher2_thread_U
+#define CHAR_NAME "cher2_thread_U_"
+#define CHAR_CNAME "cher2_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/syr2_thread.c"
\ No newline at end of file
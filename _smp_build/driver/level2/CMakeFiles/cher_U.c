@@ -0,0 +1,8 @@
+#define ASMNAME cher_U
+#define ASMFNAME cher_U_
+#define NAME cher_U_
+#define CNAME cher_U
+#define CHAR_NAME "cher_U_"
+#define CHAR_CNAME "cher_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zher_k.c"
\ No newline at end of file
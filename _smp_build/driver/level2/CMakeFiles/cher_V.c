@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME cher_V
+#define ASMFNAME cher_V_
+#define NAME cher_V_
+#define CNAME cher_V
+#define CHAR_NAME "cher_V_"
+#define CHAR_CNAME "cher_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/zher_k.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define HER
+#define LOWER
+#define ASMNAME cher_thread_L
+#define ASMFNAME cher_thread_L_
+#define NAME cher_thread_L_
+#define CNAME cher_thread_L
+#define CHAR_NAME "cher_thread_L_"
+#define CHAR_CNAME "cher_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/syr_thread.c"
\ No newline at end of file
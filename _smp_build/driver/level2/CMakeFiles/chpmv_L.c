@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME chpmv_L
+#define ASMFNAME chpmv_L_
+#define NAME chpmv_L_
+#define CNAME chpmv_L
+#define CHAR_NAME "chpmv_L_"
+#define CHAR_CNAME "chpmv_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpmv_k.c"
\ No newline at end of file
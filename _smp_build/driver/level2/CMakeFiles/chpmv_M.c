@@ -0,0 +1,10 @@
+#define LOWER
+#define HEMVREV
+#define ASMNAME chpmv_M
+#define ASMFNAME chpmv_M_
+#define NAME chpmv_M_
+#define CNAME chpmv_M
+#define CHAR_NAME "chpmv_M_"
+#define CHAR_CNAME "chpmv_M"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpmv_k.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME chpmv_U
+#define ASMFNAME chpmv_U_
+#define NAME chpmv_U_
+#define CNAME chpmv_U
+#define CHAR_NAME "chpmv_U_"
+#define CHAR_CNAME "chpmv_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpmv_k.c"
\ No newline at end of file
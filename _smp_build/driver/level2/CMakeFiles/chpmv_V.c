@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chpmv_V
+#define ASMFNAME chpmv_V_
+#define NAME chpmv_V_
+#define CNAME chpmv_V
+#define CHAR_NAME "chpmv_V_"
+#define CHAR_CNAME "chpmv_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpmv_k.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define HEMVREV
+#define ASMNAME chpmv_thread_M
+#define ASMFNAME chpmv_thread_M_
+#define NAME chpmv_thread_M_
+#define CNAME chpmv_thread_M
+#define CHAR_NAME "chpmv_thread_M_"
+#define CHAR_CNAME "chpmv_thread_M"
+#define COMPLEX
+#include "/root/repo/driver/level2/spmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chpmv_thread_V
+#define ASMFNAME chpmv_thread_V_
+#define NAME chpmv_thread_V_
+#define CNAME chpmv_thread_V
+#define CHAR_NAME "chpmv_thread_V_"
+#define CHAR_CNAME "chpmv_thread_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/spmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME chpr2_U
+#define ASMFNAME chpr2_U_
+#define NAME chpr2_U_
+#define CNAME chpr2_U
+#define CHAR_NAME "chpr2_U_"
+#define CHAR_CNAME "chpr2_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpr2_k.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define HEMV
+#define LOWER
+#define ASMNAME chpr2_thread_L
+#define ASMFNAME chpr2_thread_L_
+#define NAME chpr2_thread_L_
+#define CNAME chpr2_thread_L
+#define CHAR_NAME "chpr2_thread_L_"
+#define CHAR_CNAME "chpr2_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/spr2_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME chpr_U
+#define ASMFNAME chpr_U_
+#define NAME chpr_U_
+#define CNAME chpr_U
+#define CHAR_NAME "chpr_U_"
+#define CHAR_CNAME "chpr_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpr_k.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define HEMVREV
+#define ASMNAME chpr_V
+#define ASMFNAME chpr_V_
+#define NAME chpr_V_
+#define CNAME chpr_V
+#define CHAR_NAME "chpr_V_"
+#define CHAR_CNAME "chpr_V"
+#define COMPLEX
+#include "/root/repo/driver/level2/zhpr_k.c"
\ No newline at end of file
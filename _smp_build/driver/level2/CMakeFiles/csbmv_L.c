@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME csbmv_L
+#define ASMFNAME csbmv_L_
+#define NAME csbmv_L_
+#define CNAME csbmv_L
+#define CHAR_NAME "csbmv_L_"
+#define CHAR_CNAME "csbmv_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/zsbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME csbmv_U
+#define ASMFNAME csbmv_U_
+#define NAME csbmv_U_
+#define CNAME csbmv_U
+#define CHAR_NAME "csbmv_U_"
+#define CHAR_CNAME "csbmv_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zsbmv_k.c"
\ No newline at end of file
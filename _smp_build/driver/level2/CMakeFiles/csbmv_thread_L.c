@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME csbmv_thread_L
+#define ASMFNAME csbmv_thread_L_
+#define NAME csbmv_thread_L_
+#define CNAME csbmv_thread_L
+#define CHAR_NAME "csbmv_thread_L_"
+#define CHAR_CNAME "csbmv_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/sbmv_thread.c"
\ No newline at end of file
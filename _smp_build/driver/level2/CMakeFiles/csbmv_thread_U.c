@@ -0,0 +1,8 @@
+#define ASMNAME csbmv_thread_U
+#define ASMFNAME csbmv_thread_U_
+#define NAME csbmv_thread_U_
+#define CNAME csbmv_thread_U
+#define CHAR_NAME "csbmv_thread_U_"
+#define CHAR_CNAME "csbmv_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/sbmv_thread.c"
\ No newline at end of file
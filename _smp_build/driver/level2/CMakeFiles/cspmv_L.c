@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME cspmv_L
+#define ASMFNAME cspmv_L_
+#define NAME cspmv_L_
+#define CNAME cspmv_L
+#define CHAR_NAME "cspmv_L_"
+#define CHAR_CNAME "cspmv_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/zspmv_k.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME cspmv_U
+#define ASMFNAME cspmv_U_
+#define NAME cspmv_U_
+#define CNAME cspmv_U
+#define CHAR_NAME "cspmv_U_"
+#define CHAR_CNAME "cspmv_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zspmv_k.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME cspmv_thread_L
+#define ASMFNAME cspmv_thread_L_
+#define NAME cspmv_thread_L_
+#define CNAME cspmv_thread_L
+#define CHAR_NAME "cspmv_thread_L_"
+#define CHAR_CNAME "cspmv_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/spmv_thread.c"
\ No newline at end of file
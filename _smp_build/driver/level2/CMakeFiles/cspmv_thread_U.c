@@ -0,0 +1,8 @@
+#define ASMNAME cspmv_thread_U
+#define ASMFNAME cspmv_thread_U_
+#define NAME cspmv_thread_U_
+#define CNAME cspmv_thread_U
+#define CHAR_NAME "cspmv_thread_U_"
+#define CHAR_CNAME "cspmv_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/spmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME cspr2_L
+#define ASMFNAME cspr2_L_
+#define NAME cspr2_L_
+#define CNAME cspr2_L
+#define CHAR_NAME "cspr2_L_"
+#define CHAR_CNAME "cspr2_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/zspr2_k.c"
\ No newline at end of file
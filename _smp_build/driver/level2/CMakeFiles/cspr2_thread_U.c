@@ -0,0 +1,8 @@
+#define ASMNAME cspr2_thread_U
+#define ASMFNAME cspr2_thread_U_
+#define NAME cspr2_thread_U_
+#define CNAME cspr2_thread_U
+#define CHAR_NAME "cspr2_thread_U_"
+#define CHAR_CNAME "cspr2_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/spr2_thread.c"
\ No newline at end of file
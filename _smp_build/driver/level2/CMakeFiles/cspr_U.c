@@ -0,0 +1,8 @@
+#define ASMNAME cspr_U
+#define ASMFNAME cspr_U_
+#define NAME cspr_U_
+#define CNAME cspr_U
+#define CHAR_NAME "cspr_U_"
+#define CHAR_CNAME "cspr_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zspr_k.c"
\ No newline at end of file
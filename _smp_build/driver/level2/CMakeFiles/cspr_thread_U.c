@@ -0,0 +1,8 @@
+#define ASMNAME cspr_thread_U
+#define ASMFNAME cspr_thread_U_
+#define NAME cspr_thread_U_
+#define CNAME cspr_thread_U
+#define CHAR_NAME "cspr_thread_U_"
+#define CHAR_CNAME "cspr_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/spr_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME csymv_thread_L
+#define ASMFNAME csymv_thread_L_
+#define NAME csymv_thread_L_
+#define CNAME csymv_thread_L
+#define CHAR_NAME "csymv_thread_L_"
+#define CHAR_CNAME "csymv_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/symv_thread.c"
\ No newline at end of file
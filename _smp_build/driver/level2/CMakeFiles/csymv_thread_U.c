@@ -0,0 +1,8 @@
+#define ASMNAME csymv_thread_U
+#define ASMFNAME csymv_thread_U_
+#define NAME csymv_thread_U_
+#define CNAME csymv_thread_U
+#define CHAR_NAME "csymv_thread_U_"
+#define CHAR_CNAME "csymv_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/symv_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME csyr2_U
+#define ASMFNAME csyr2_U_
+#define NAME csyr2_U_
+#define CNAME csyr2_U
+#define CHAR_NAME "csyr2_U_"
+#define CHAR_CNAME "csyr2_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zsyr2_k.c"
\ No newline at end of file
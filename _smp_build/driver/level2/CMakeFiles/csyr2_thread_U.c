@@ -0,0 +1,8 @@
+#define ASMNAME csyr2_thread_U
+#define ASMFNAME csyr2_thread_U_
+#define NAME csyr2_thread_U_
+#define CNAME csyr2_thread_U
+#define CHAR_NAME "csyr2_thread_U_"
+#define CHAR_CNAME "csyr2_thread_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/syr2_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME csyr_U
+#define ASMFNAME csyr_U_
+#define NAME csyr_U_
+#define CNAME csyr_U
+#define CHAR_NAME "csyr_U_"
+#define CHAR_CNAME "csyr_U"
+#define COMPLEX
+#include "/root/repo/driver/level2/zsyr_k.c"
\ No newline at end of file
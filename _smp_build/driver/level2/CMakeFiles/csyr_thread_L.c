@@ -0,0 +1,9 @@
+#define LOWER
+#define ASMNAME csyr_thread_L
+#define ASMFNAME csyr_thread_L_
+#define NAME csyr_thread_L_
+#define CNAME csyr_thread_L
+#define CHAR_NAME "csyr_thread_L_"
+#define CHAR_CNAME "csyr_thread_L"
+#define COMPLEX
+#include "/root/repo/driver/level2/syr_thread.c"
\ No newline at end of file
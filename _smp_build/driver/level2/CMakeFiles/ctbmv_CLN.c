@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctbmv_CLN
+#define ASMFNAME ctbmv_CLN_
+#define NAME ctbmv_CLN_
+#define CNAME ctbmv_CLN
+#define CHAR_NAME "ctbmv_CLN_"
+#define CHAR_CNAME "ctbmv_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_U.c"
\ No newline at end of file
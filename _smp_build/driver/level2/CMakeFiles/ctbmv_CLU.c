@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbmv_CLU
+#define ASMFNAME ctbmv_CLU_
+#define NAME ctbmv_CLU_
+#define CNAME ctbmv_CLU
+#define CHAR_NAME "ctbmv_CLU_"
+#define CHAR_CNAME "ctbmv_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_U.c"
\ No newline at end of file
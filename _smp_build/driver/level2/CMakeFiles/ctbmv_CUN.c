@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctbmv_CUN
+#define ASMFNAME ctbmv_CUN_
+#define NAME ctbmv_CUN_
+#define CNAME ctbmv_CUN
+#define CHAR_NAME "ctbmv_CUN_"
+#define CHAR_CNAME "ctbmv_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_L.c"
\ No newline at end of file
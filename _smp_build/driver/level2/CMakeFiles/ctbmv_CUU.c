@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbmv_CUU
+#define ASMFNAME ctbmv_CUU_
+#define NAME ctbmv_CUU_
+#define CNAME ctbmv_CUU
+#define CHAR_NAME "ctbmv_CUU_"
+#define CHAR_CNAME "ctbmv_CUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_L.c"
\ No newline at end of file
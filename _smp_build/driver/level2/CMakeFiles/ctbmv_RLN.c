@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctbmv_RLN
+#define ASMFNAME ctbmv_RLN_
+#define NAME ctbmv_RLN_
+#define CNAME ctbmv_RLN
+#define CHAR_NAME "ctbmv_RLN_"
+#define CHAR_CNAME "ctbmv_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_L.c"
\ No newline at end of file
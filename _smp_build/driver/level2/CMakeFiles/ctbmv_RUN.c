@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctbmv_RUN
+#define ASMFNAME ctbmv_RUN_
+#define NAME ctbmv_RUN_
+#define CNAME ctbmv_RUN
+#define CHAR_NAME "ctbmv_RUN_"
+#define CHAR_CNAME "ctbmv_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_U.c"
\ No newline at end of file
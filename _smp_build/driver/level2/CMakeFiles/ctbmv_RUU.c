@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctbmv_RUU
+#define ASMFNAME ctbmv_RUU_
+#define NAME ctbmv_RUU_
+#define CNAME ctbmv_RUU
+#define CHAR_NAME "ctbmv_RUU_"
+#define CHAR_CNAME "ctbmv_RUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbmv_U.c"
\ No newline at end of file
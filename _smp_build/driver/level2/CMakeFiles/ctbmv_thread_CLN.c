@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 4
+#define ASMNAME ctbmv_thread_CLN
+#define ASMFNAME ctbmv_thread_CLN_
+#define NAME ctbmv_thread_CLN_
+#define CNAME ctbmv_thread_CLN
+#define CHAR_NAME "ctbmv_thread_CLN_"
+#define CHAR_CNAME "ctbmv_thread_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
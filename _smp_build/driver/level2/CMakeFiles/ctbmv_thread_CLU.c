@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbmv_thread_CLU
+#define ASMFNAME ctbmv_thread_CLU_
+#define NAME ctbmv_thread_CLU_
+#define CNAME ctbmv_thread_CLU
+#define CHAR_NAME "ctbmv_thread_CLU_"
+#define CHAR_CNAME "ctbmv_thread_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctbmv_thread_CUN
+#define ASMFNAME ctbmv_thread_CUN_
+#define NAME ctbmv_thread_CUN_
+#define CNAME ctbmv_thread_CUN
+#define CHAR_NAME "ctbmv_thread_CUN_"
+#define CHAR_CNAME "ctbmv_thread_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbmv_thread_CUU
+#define ASMFNAME ctbmv_thread_CUU_
+#define NAME ctbmv_thread_CUU_
+#define CNAME ctbmv_thread_CUU
+#define CHAR_NAME "ctbmv_thread_CUU_"
+#define CHAR_CNAME "ctbmv_thread_CUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 1
+#define ASMNAME ctbmv_thread_NLN
+#define ASMFNAME ctbmv_thread_NLN_
+#define NAME ctbmv_thread_NLN_
+#define CNAME ctbmv_thread_NLN
+#define CHAR_NAME "ctbmv_thread_NLN_"
+#define CHAR_CNAME "ctbmv_thread_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctbmv_thread_NLU
+#define ASMFNAME ctbmv_thread_NLU_
+#define NAME ctbmv_thread_NLU_
+#define CNAME ctbmv_thread_NLU
+#define CHAR_NAME "ctbmv_thread_NLU_"
+#define CHAR_CNAME "ctbmv_thread_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctbmv_thread_NUN
+#define ASMFNAME ctbmv_thread_NUN_
+#define NAME ctbmv_thread_NUN_
+#define CNAME ctbmv_thread_NUN
+#define CHAR_NAME "ctbmv_thread_NUN_"
+#define CHAR_CNAME "ctbmv_thread_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
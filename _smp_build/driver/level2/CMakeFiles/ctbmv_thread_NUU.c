@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctbmv_thread_NUU
+#define ASMFNAME ctbmv_thread_NUU_
+#define NAME ctbmv_thread_NUU_
+#define CNAME ctbmv_thread_NUU
+#define CHAR_NAME "ctbmv_thread_NUU_"
+#define CHAR_CNAME "ctbmv_thread_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
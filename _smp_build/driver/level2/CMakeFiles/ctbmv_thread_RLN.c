@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 3
+#define ASMNAME ctbmv_thread_RLN
+#define ASMFNAME ctbmv_thread_RLN_
+#define NAME ctbmv_thread_RLN_
+#define CNAME ctbmv_thread_RLN
+#define CHAR_NAME "ctbmv_thread_RLN_"
+#define CHAR_CNAME "ctbmv_thread_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
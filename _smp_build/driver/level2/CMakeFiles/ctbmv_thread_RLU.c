@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctbmv_thread_RLU
+#define ASMFNAME ctbmv_thread_RLU_
+#define NAME ctbmv_thread_RLU_
+#define CNAME ctbmv_thread_RLU
+#define CHAR_NAME "ctbmv_thread_RLU_"
+#define CHAR_CNAME "ctbmv_thread_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
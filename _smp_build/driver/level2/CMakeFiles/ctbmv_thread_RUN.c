@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctbmv_thread_RUN
+#define ASMFNAME ctbmv_thread_RUN_
+#define NAME ctbmv_thread_RUN_
+#define CNAME ctbmv_thread_RUN
+#define CHAR_NAME "ctbmv_thread_RUN_"
+#define CHAR_CNAME "ctbmv_thread_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
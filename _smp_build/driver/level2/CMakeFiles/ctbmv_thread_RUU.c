@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctbmv_thread_RUU
+#define ASMFNAME ctbmv_thread_RUU_
+#define NAME ctbmv_thread_RUU_
+#define CNAME ctbmv_thread_RUU
+#define CHAR_NAME "ctbmv_thread_RUU_"
+#define CHAR_CNAME "ctbmv_thread_RUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
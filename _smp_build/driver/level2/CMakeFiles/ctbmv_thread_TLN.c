@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 2
+#define ASMNAME ctbmv_thread_TLN
+#define ASMFNAME ctbmv_thread_TLN_
+#define NAME ctbmv_thread_TLN_
+#define CNAME ctbmv_thread_TLN
+#define CHAR_NAME "ctbmv_thread_TLN_"
+#define CHAR_CNAME "ctbmv_thread_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
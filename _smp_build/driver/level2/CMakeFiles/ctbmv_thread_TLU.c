@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctbmv_thread_TLU
+#define ASMFNAME ctbmv_thread_TLU_
+#define NAME ctbmv_thread_TLU_
+#define CNAME ctbmv_thread_TLU
+#define CHAR_NAME "ctbmv_thread_TLU_"
+#define CHAR_CNAME "ctbmv_thread_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctbmv_thread_TUN
+#define ASMFNAME ctbmv_thread_TUN_
+#define NAME ctbmv_thread_TUN_
+#define CNAME ctbmv_thread_TUN
+#define CHAR_NAME "ctbmv_thread_TUN_"
+#define CHAR_CNAME "ctbmv_thread_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctbmv_thread_TUU
+#define ASMFNAME ctbmv_thread_TUU_
+#define NAME ctbmv_thread_TUU_
+#define CNAME ctbmv_thread_TUU
+#define CHAR_NAME "ctbmv_thread_TUU_"
+#define CHAR_CNAME "ctbmv_thread_TUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tbmv_thread.c"
\ No newline at end of file
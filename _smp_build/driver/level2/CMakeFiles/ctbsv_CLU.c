@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbsv_CLU
+#define ASMFNAME ctbsv_CLU_
+#define NAME ctbsv_CLU_
+#define CNAME ctbsv_CLU
+#define CHAR_NAME "ctbsv_CLU_"
+#define CHAR_CNAME "ctbsv_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbsv_U.c"
\ No newline at end of file
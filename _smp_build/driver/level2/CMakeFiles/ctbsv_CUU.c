@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctbsv_CUU
+#define ASMFNAME ctbsv_CUU_
+#define NAME ctbsv_CUU_
+#define CNAME ctbsv_CUU
+#define CHAR_NAME "ctbsv_CUU_"
+#define CHAR_CNAME "ctbsv_CUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbsv_L.c"
\ No newline at end of file
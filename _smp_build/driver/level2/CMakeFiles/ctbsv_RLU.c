@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctbsv_RLU
+#define ASMFNAME ctbsv_RLU_
+#define NAME ctbsv_RLU_
+#define CNAME ctbsv_RLU
+#define CHAR_NAME "ctbsv_RLU_"
+#define CHAR_CNAME "ctbsv_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbsv_L.c"
\ No newline at end of file
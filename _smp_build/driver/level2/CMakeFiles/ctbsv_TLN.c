@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctbsv_TLN
+#define ASMFNAME ctbsv_TLN_
+#define NAME ctbsv_TLN_
+#define CNAME ctbsv_TLN
+#define CHAR_NAME "ctbsv_TLN_"
+#define CHAR_CNAME "ctbsv_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztbsv_U.c"
\ No newline at end of file
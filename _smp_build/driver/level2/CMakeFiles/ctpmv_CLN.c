@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctpmv_CLN
+#define ASMFNAME ctpmv_CLN_
+#define NAME ctpmv_CLN_
+#define CNAME ctpmv_CLN
+#define CHAR_NAME "ctpmv_CLN_"
+#define CHAR_CNAME "ctpmv_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
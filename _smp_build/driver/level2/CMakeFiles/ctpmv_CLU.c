@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctpmv_CLU
+#define ASMFNAME ctpmv_CLU_
+#define NAME ctpmv_CLU_
+#define CNAME ctpmv_CLU
+#define CHAR_NAME "ctpmv_CLU_"
+#define CHAR_CNAME "ctpmv_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctpmv_NLN
+#define ASMFNAME ctpmv_NLN_
+#define NAME ctpmv_NLN_
+#define CNAME ctpmv_NLN
+#define CHAR_NAME "ctpmv_NLN_"
+#define CHAR_CNAME "ctpmv_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_L.c"
\ No newline at end of file
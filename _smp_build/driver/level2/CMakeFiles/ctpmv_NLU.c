@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctpmv_NLU
+#define ASMFNAME ctpmv_NLU_
+#define NAME ctpmv_NLU_
+#define CNAME ctpmv_NLU
+#define CHAR_NAME "ctpmv_NLU_"
+#define CHAR_CNAME "ctpmv_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_L.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctpmv_NUN
+#define ASMFNAME ctpmv_NUN_
+#define NAME ctpmv_NUN_
+#define CNAME ctpmv_NUN
+#define CHAR_NAME "ctpmv_NUN_"
+#define CHAR_CNAME "ctpmv_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
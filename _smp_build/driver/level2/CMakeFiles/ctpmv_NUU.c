@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctpmv_NUU
+#define ASMFNAME ctpmv_NUU_
+#define NAME ctpmv_NUU_
+#define CNAME ctpmv_NUU
+#define CHAR_NAME "ctpmv_NUU_"
+#define CHAR_CNAME "ctpmv_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctpmv_RLU
+#define ASMFNAME ctpmv_RLU_
+#define NAME ctpmv_RLU_
+#define CNAME ctpmv_RLU
+#define CHAR_NAME "ctpmv_RLU_"
+#define CHAR_CNAME "ctpmv_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_L.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctpmv_RUN
+#define ASMFNAME ctpmv_RUN_
+#define NAME ctpmv_RUN_
+#define CNAME ctpmv_RUN
+#define CHAR_NAME "ctpmv_RUN_"
+#define CHAR_CNAME "ctpmv_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctpmv_TLN
+#define ASMFNAME ctpmv_TLN_
+#define NAME ctpmv_TLN_
+#define CNAME ctpmv_TLN
+#define CHAR_NAME "ctpmv_TLN_"
+#define CHAR_CNAME "ctpmv_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
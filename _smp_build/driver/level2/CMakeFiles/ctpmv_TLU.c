@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpmv_TLU
+#define ASMFNAME ctpmv_TLU_
+#define NAME ctpmv_TLU_
+#define CNAME ctpmv_TLU
+#define CHAR_NAME "ctpmv_TLU_"
+#define CHAR_CNAME "ctpmv_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctpmv_TUN
+#define ASMFNAME ctpmv_TUN_
+#define NAME ctpmv_TUN_
+#define CNAME ctpmv_TUN
+#define CHAR_NAME "ctpmv_TUN_"
+#define CHAR_CNAME "ctpmv_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_L.c"
\ No newline at end of file
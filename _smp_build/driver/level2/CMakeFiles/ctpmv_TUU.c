@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpmv_TUU
+#define ASMFNAME ctpmv_TUU_
+#define NAME ctpmv_TUU_
+#define CNAME ctpmv_TUU
+#define CHAR_NAME "ctpmv_TUU_"
+#define CHAR_CNAME "ctpmv_TUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpmv_L.c"
\ No newline at end of file
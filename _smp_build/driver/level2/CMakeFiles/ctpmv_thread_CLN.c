@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 4
+#define ASMNAME ctpmv_thread_CLN
+#define ASMFNAME ctpmv_thread_CLN_
+#define NAME ctpmv_thread_CLN_
+#define CNAME ctpmv_thread_CLN
+#define CHAR_NAME "ctpmv_thread_CLN_"
+#define CHAR_CNAME "ctpmv_thread_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctpmv_thread_CLU
+#define ASMFNAME ctpmv_thread_CLU_
+#define NAME ctpmv_thread_CLU_
+#define CNAME ctpmv_thread_CLU
+#define CHAR_NAME "ctpmv_thread_CLU_"
+#define CHAR_CNAME "ctpmv_thread_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
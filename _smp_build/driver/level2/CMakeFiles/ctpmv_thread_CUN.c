@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctpmv_thread_CUN
+#define ASMFNAME ctpmv_thread_CUN_
+#define NAME ctpmv_thread_CUN_
+#define CNAME ctpmv_thread_CUN
+#define CHAR_NAME "ctpmv_thread_CUN_"
+#define CHAR_CNAME "ctpmv_thread_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctpmv_thread_CUU
+#define ASMFNAME ctpmv_thread_CUU_
+#define NAME ctpmv_thread_CUU_
+#define CNAME ctpmv_thread_CUU
+#define CHAR_NAME "ctpmv_thread_CUU_"
+#define CHAR_CNAME "ctpmv_thread_CUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 1
+#define ASMNAME ctpmv_thread_NLN
+#define ASMFNAME ctpmv_thread_NLN_
+#define NAME ctpmv_thread_NLN_
+#define CNAME ctpmv_thread_NLN
+#define CHAR_NAME "ctpmv_thread_NLN_"
+#define CHAR_CNAME "ctpmv_thread_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
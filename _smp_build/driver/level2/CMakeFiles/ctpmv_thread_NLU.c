@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctpmv_thread_NLU
+#define ASMFNAME ctpmv_thread_NLU_
+#define NAME ctpmv_thread_NLU_
+#define CNAME ctpmv_thread_NLU
+#define CHAR_NAME "ctpmv_thread_NLU_"
+#define CHAR_CNAME "ctpmv_thread_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
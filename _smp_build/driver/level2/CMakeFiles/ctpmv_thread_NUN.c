@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctpmv_thread_NUN
+#define ASMFNAME ctpmv_thread_NUN_
+#define NAME ctpmv_thread_NUN_
+#define CNAME ctpmv_thread_NUN
+#define CHAR_NAME "ctpmv_thread_NUN_"
+#define CHAR_CNAME "ctpmv_thread_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
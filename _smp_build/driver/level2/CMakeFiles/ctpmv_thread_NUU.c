@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctpmv_thread_NUU
+#define ASMFNAME ctpmv_thread_NUU_
+#define NAME ctpmv_thread_NUU_
+#define CNAME ctpmv_thread_NUU
+#define CHAR_NAME "ctpmv_thread_NUU_"
+#define CHAR_CNAME "ctpmv_thread_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 3
+#define ASMNAME ctpmv_thread_RLN
+#define ASMFNAME ctpmv_thread_RLN_
+#define NAME ctpmv_thread_RLN_
+#define CNAME ctpmv_thread_RLN
+#define CHAR_NAME "ctpmv_thread_RLN_"
+#define CHAR_CNAME "ctpmv_thread_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
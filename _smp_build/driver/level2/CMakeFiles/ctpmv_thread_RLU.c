@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctpmv_thread_RLU
+#define ASMFNAME ctpmv_thread_RLU_
+#define NAME ctpmv_thread_RLU_
+#define CNAME ctpmv_thread_RLU
+#define CHAR_NAME "ctpmv_thread_RLU_"
+#define CHAR_CNAME "ctpmv_thread_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctpmv_thread_RUN
+#define ASMFNAME ctpmv_thread_RUN_
+#define NAME ctpmv_thread_RUN_
+#define CNAME ctpmv_thread_RUN
+#define CHAR_NAME "ctpmv_thread_RUN_"
+#define CHAR_CNAME "ctpmv_thread_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctpmv_thread_RUU
+#define ASMFNAME ctpmv_thread_RUU_
+#define NAME ctpmv_thread_RUU_
+#define CNAME ctpmv_thread_RUU
+#define CHAR_NAME "ctpmv_thread_RUU_"
+#define CHAR_CNAME "ctpmv_thread_RUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 2
+#define ASMNAME ctpmv_thread_TLN
+#define ASMFNAME ctpmv_thread_TLN_
+#define NAME ctpmv_thread_TLN_
+#define CNAME ctpmv_thread_TLN
+#define CHAR_NAME "ctpmv_thread_TLN_"
+#define CHAR_CNAME "ctpmv_thread_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpmv_thread_TLU
+#define ASMFNAME ctpmv_thread_TLU_
+#define NAME ctpmv_thread_TLU_
+#define CNAME ctpmv_thread_TLU
+#define CHAR_NAME "ctpmv_thread_TLU_"
+#define CHAR_CNAME "ctpmv_thread_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
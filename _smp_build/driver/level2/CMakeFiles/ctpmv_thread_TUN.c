@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctpmv_thread_TUN
+#define ASMFNAME ctpmv_thread_TUN_
+#define NAME ctpmv_thread_TUN_
+#define CNAME ctpmv_thread_TUN
+#define CHAR_NAME "ctpmv_thread_TUN_"
+#define CHAR_CNAME "ctpmv_thread_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpmv_thread_TUU
+#define ASMFNAME ctpmv_thread_TUU_
+#define NAME ctpmv_thread_TUU_
+#define CNAME ctpmv_thread_TUU
+#define CHAR_NAME "ctpmv_thread_TUU_"
+#define CHAR_CNAME "ctpmv_thread_TUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/tpmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctpsv_CUN
+#define ASMFNAME ctpsv_CUN_
+#define NAME ctpsv_CUN_
+#define CNAME ctpsv_CUN
+#define CHAR_NAME "ctpsv_CUN_"
+#define CHAR_CNAME "ctpsv_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpsv_L.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctpsv_NLU
+#define ASMFNAME ctpsv_NLU_
+#define NAME ctpsv_NLU_
+#define CNAME ctpsv_NLU
+#define CHAR_NAME "ctpsv_NLU_"
+#define CHAR_CNAME "ctpsv_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpsv_L.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctpsv_RLU
+#define ASMFNAME ctpsv_RLU_
+#define NAME ctpsv_RLU_
+#define CNAME ctpsv_RLU
+#define CHAR_NAME "ctpsv_RLU_"
+#define CHAR_CNAME "ctpsv_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpsv_L.c"
\ No newline at end of file
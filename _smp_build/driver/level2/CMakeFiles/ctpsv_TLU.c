@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpsv_TLU
+#define ASMFNAME ctpsv_TLU_
+#define NAME ctpsv_TLU_
+#define CNAME ctpsv_TLU
+#define CHAR_NAME "ctpsv_TLU_"
+#define CHAR_CNAME "ctpsv_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpsv_U.c"
\ No newline at end of file
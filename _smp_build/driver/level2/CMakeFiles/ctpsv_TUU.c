@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctpsv_TUU
+#define ASMFNAME ctpsv_TUU_
+#define NAME ctpsv_TUU_
+#define CNAME ctpsv_TUU
+#define CHAR_NAME "ctpsv_TUU_"
+#define CHAR_CNAME "ctpsv_TUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztpsv_L.c"
\ No newline at end of file
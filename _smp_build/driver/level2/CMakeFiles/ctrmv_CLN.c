@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctrmv_CLN
+#define ASMFNAME ctrmv_CLN_
+#define NAME ctrmv_CLN_
+#define CNAME ctrmv_CLN
+#define CHAR_NAME "ctrmv_CLN_"
+#define CHAR_CNAME "ctrmv_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
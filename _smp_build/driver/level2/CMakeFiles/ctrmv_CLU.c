@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctrmv_CLU
+#define ASMFNAME ctrmv_CLU_
+#define NAME ctrmv_CLU_
+#define CNAME ctrmv_CLU
+#define CHAR_NAME "ctrmv_CLU_"
+#define CHAR_CNAME "ctrmv_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
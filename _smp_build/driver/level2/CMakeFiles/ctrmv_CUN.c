@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctrmv_CUN
+#define ASMFNAME ctrmv_CUN_
+#define NAME ctrmv_CUN_
+#define CNAME ctrmv_CUN
+#define CHAR_NAME "ctrmv_CUN_"
+#define CHAR_CNAME "ctrmv_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_L.c"
\ No newline at end of file
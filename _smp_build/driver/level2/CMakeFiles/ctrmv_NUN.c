@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctrmv_NUN
+#define ASMFNAME ctrmv_NUN_
+#define NAME ctrmv_NUN_
+#define CNAME ctrmv_NUN
+#define CHAR_NAME "ctrmv_NUN_"
+#define CHAR_CNAME "ctrmv_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrmv_NUU
+#define ASMFNAME ctrmv_NUU_
+#define NAME ctrmv_NUU_
+#define CNAME ctrmv_NUU
+#define CHAR_NAME "ctrmv_NUU_"
+#define CHAR_CNAME "ctrmv_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctrmv_RUN
+#define ASMFNAME ctrmv_RUN_
+#define NAME ctrmv_RUN_
+#define CNAME ctrmv_RUN
+#define CHAR_NAME "ctrmv_RUN_"
+#define CHAR_CNAME "ctrmv_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
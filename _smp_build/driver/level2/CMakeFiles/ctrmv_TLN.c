@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctrmv_TLN
+#define ASMFNAME ctrmv_TLN_
+#define NAME ctrmv_TLN_
+#define CNAME ctrmv_TLN
+#define CHAR_NAME "ctrmv_TLN_"
+#define CHAR_CNAME "ctrmv_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
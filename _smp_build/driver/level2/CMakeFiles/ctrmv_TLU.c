@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctrmv_TLU
+#define ASMFNAME ctrmv_TLU_
+#define NAME ctrmv_TLU_
+#define CNAME ctrmv_TLU
+#define CHAR_NAME "ctrmv_TLU_"
+#define CHAR_CNAME "ctrmv_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrmv_U.c"
\ No newline at end of file
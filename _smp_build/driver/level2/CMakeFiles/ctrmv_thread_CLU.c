@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctrmv_thread_CLU
+#define ASMFNAME ctrmv_thread_CLU_
+#define NAME ctrmv_thread_CLU_
+#define CNAME ctrmv_thread_CLU
+#define CHAR_NAME "ctrmv_thread_CLU_"
+#define CHAR_CNAME "ctrmv_thread_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 1
+#define ASMNAME ctrmv_thread_NLN
+#define ASMFNAME ctrmv_thread_NLN_
+#define NAME ctrmv_thread_NLN_
+#define CNAME ctrmv_thread_NLN
+#define CHAR_NAME "ctrmv_thread_NLN_"
+#define CHAR_CNAME "ctrmv_thread_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
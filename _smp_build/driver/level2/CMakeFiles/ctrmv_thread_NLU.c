@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrmv_thread_NLU
+#define ASMFNAME ctrmv_thread_NLU_
+#define NAME ctrmv_thread_NLU_
+#define CNAME ctrmv_thread_NLU
+#define CHAR_NAME "ctrmv_thread_NLU_"
+#define CHAR_CNAME "ctrmv_thread_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctrmv_thread_NUN
+#define ASMFNAME ctrmv_thread_NUN_
+#define NAME ctrmv_thread_NUN_
+#define CNAME ctrmv_thread_NUN
+#define CHAR_NAME "ctrmv_thread_NUN_"
+#define CHAR_CNAME "ctrmv_thread_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
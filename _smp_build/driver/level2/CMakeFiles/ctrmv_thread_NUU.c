@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrmv_thread_NUU
+#define ASMFNAME ctrmv_thread_NUU_
+#define NAME ctrmv_thread_NUU_
+#define CNAME ctrmv_thread_NUU
+#define CHAR_NAME "ctrmv_thread_NUU_"
+#define CHAR_CNAME "ctrmv_thread_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
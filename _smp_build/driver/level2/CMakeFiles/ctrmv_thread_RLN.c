@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 3
+#define ASMNAME ctrmv_thread_RLN
+#define ASMFNAME ctrmv_thread_RLN_
+#define NAME ctrmv_thread_RLN_
+#define CNAME ctrmv_thread_RLN
+#define CHAR_NAME "ctrmv_thread_RLN_"
+#define CHAR_CNAME "ctrmv_thread_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctrmv_thread_RUN
+#define ASMFNAME ctrmv_thread_RUN_
+#define NAME ctrmv_thread_RUN_
+#define CNAME ctrmv_thread_RUN
+#define CHAR_NAME "ctrmv_thread_RUN_"
+#define CHAR_CNAME "ctrmv_thread_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctrmv_thread_RUU
+#define ASMFNAME ctrmv_thread_RUU_
+#define NAME ctrmv_thread_RUU_
+#define CNAME ctrmv_thread_RUU
+#define CHAR_NAME "ctrmv_thread_RUU_"
+#define CHAR_CNAME "ctrmv_thread_RUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
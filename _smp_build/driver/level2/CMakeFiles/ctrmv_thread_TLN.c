@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 2
+#define ASMNAME ctrmv_thread_TLN
+#define ASMFNAME ctrmv_thread_TLN_
+#define NAME ctrmv_thread_TLN_
+#define CNAME ctrmv_thread_TLN
+#define CHAR_NAME "ctrmv_thread_TLN_"
+#define CHAR_CNAME "ctrmv_thread_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
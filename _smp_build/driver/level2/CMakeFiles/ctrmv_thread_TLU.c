@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctrmv_thread_TLU
+#define ASMFNAME ctrmv_thread_TLU_
+#define NAME ctrmv_thread_TLU_
+#define CNAME ctrmv_thread_TLU
+#define CHAR_NAME "ctrmv_thread_TLU_"
+#define CHAR_CNAME "ctrmv_thread_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
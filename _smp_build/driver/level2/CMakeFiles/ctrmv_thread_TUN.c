@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctrmv_thread_TUN
+#define ASMFNAME ctrmv_thread_TUN_
+#define NAME ctrmv_thread_TUN_
+#define CNAME ctrmv_thread_TUN
+#define CHAR_NAME "ctrmv_thread_TUN_"
+#define CHAR_CNAME "ctrmv_thread_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trmv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctrsv_CLN
+#define ASMFNAME ctrsv_CLN_
+#define NAME ctrsv_CLN_
+#define CNAME ctrsv_CLN
+#define CHAR_NAME "ctrsv_CLN_"
+#define CHAR_CNAME "ctrsv_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctrsv_CLU
+#define ASMFNAME ctrsv_CLU_
+#define NAME ctrsv_CLU_
+#define CNAME ctrsv_CLU
+#define CHAR_NAME "ctrsv_CLU_"
+#define CHAR_CNAME "ctrsv_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctrsv_CUN
+#define ASMFNAME ctrsv_CUN_
+#define NAME ctrsv_CUN_
+#define CNAME ctrsv_CUN
+#define CHAR_NAME "ctrsv_CUN_"
+#define CHAR_CNAME "ctrsv_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
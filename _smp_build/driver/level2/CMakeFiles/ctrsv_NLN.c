@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctrsv_NLN
+#define ASMFNAME ctrsv_NLN_
+#define NAME ctrsv_NLN_
+#define CNAME ctrsv_NLN
+#define CHAR_NAME "ctrsv_NLN_"
+#define CHAR_CNAME "ctrsv_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrsv_NLU
+#define ASMFNAME ctrsv_NLU_
+#define NAME ctrsv_NLU_
+#define CNAME ctrsv_NLU
+#define CHAR_NAME "ctrsv_NLU_"
+#define CHAR_CNAME "ctrsv_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctrsv_NUN
+#define ASMFNAME ctrsv_NUN_
+#define NAME ctrsv_NUN_
+#define CNAME ctrsv_NUN
+#define CHAR_NAME "ctrsv_NUN_"
+#define CHAR_CNAME "ctrsv_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrsv_NUU
+#define ASMFNAME ctrsv_NUU_
+#define NAME ctrsv_NUU_
+#define CNAME ctrsv_NUU
+#define CHAR_NAME "ctrsv_NUU_"
+#define CHAR_CNAME "ctrsv_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctrsv_RLN
+#define ASMFNAME ctrsv_RLN_
+#define NAME ctrsv_RLN_
+#define CNAME ctrsv_RLN
+#define CHAR_NAME "ctrsv_RLN_"
+#define CHAR_CNAME "ctrsv_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctrsv_RLU
+#define ASMFNAME ctrsv_RLU_
+#define NAME ctrsv_RLU_
+#define CNAME ctrsv_RLU
+#define CHAR_NAME "ctrsv_RLU_"
+#define CHAR_CNAME "ctrsv_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
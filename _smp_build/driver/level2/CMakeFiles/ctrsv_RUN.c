@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctrsv_RUN
+#define ASMFNAME ctrsv_RUN_
+#define NAME ctrsv_RUN_
+#define CNAME ctrsv_RUN
+#define CHAR_NAME "ctrsv_RUN_"
+#define CHAR_CNAME "ctrsv_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctrsv_TLN
+#define ASMFNAME ctrsv_TLN_
+#define NAME ctrsv_TLN_
+#define CNAME ctrsv_TLN
+#define CHAR_NAME "ctrsv_TLN_"
+#define CHAR_CNAME "ctrsv_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctrsv_TLU
+#define ASMFNAME ctrsv_TLU_
+#define NAME ctrsv_TLU_
+#define CNAME ctrsv_TLU
+#define CHAR_NAME "ctrsv_TLU_"
+#define CHAR_CNAME "ctrsv_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_U.c"
\ No newline at end of file
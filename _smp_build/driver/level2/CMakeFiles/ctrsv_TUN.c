@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctrsv_TUN
+#define ASMFNAME ctrsv_TUN_
+#define NAME ctrsv_TUN_
+#define CNAME ctrsv_TUN
+#define CHAR_NAME "ctrsv_TUN_"
+#define CHAR_CNAME "ctrsv_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/ztrsv_L.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 4
+#define ASMNAME ctrsv_thread_CLN
+#define ASMFNAME ctrsv_thread_CLN_
+#define NAME ctrsv_thread_CLN_
+#define CNAME ctrsv_thread_CLN
+#define CHAR_NAME "ctrsv_thread_CLN_"
+#define CHAR_CNAME "ctrsv_thread_CLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctrsv_thread_CLU
+#define ASMFNAME ctrsv_thread_CLU_
+#define NAME ctrsv_thread_CLU_
+#define CNAME ctrsv_thread_CLU
+#define CHAR_NAME "ctrsv_thread_CLU_"
+#define CHAR_CNAME "ctrsv_thread_CLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 4
+#define ASMNAME ctrsv_thread_CUN
+#define ASMFNAME ctrsv_thread_CUN_
+#define NAME ctrsv_thread_CUN_
+#define CNAME ctrsv_thread_CUN
+#define CHAR_NAME "ctrsv_thread_CUN_"
+#define CHAR_CNAME "ctrsv_thread_CUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
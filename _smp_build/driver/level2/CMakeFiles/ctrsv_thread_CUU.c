@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 4
+#define ASMNAME ctrsv_thread_CUU
+#define ASMFNAME ctrsv_thread_CUU_
+#define NAME ctrsv_thread_CUU_
+#define CNAME ctrsv_thread_CUU
+#define CHAR_NAME "ctrsv_thread_CUU_"
+#define CHAR_CNAME "ctrsv_thread_CUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
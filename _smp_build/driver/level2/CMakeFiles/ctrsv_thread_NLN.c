@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 1
+#define ASMNAME ctrsv_thread_NLN
+#define ASMFNAME ctrsv_thread_NLN_
+#define NAME ctrsv_thread_NLN_
+#define CNAME ctrsv_thread_NLN
+#define CHAR_NAME "ctrsv_thread_NLN_"
+#define CHAR_CNAME "ctrsv_thread_NLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrsv_thread_NLU
+#define ASMFNAME ctrsv_thread_NLU_
+#define NAME ctrsv_thread_NLU_
+#define CNAME ctrsv_thread_NLU
+#define CHAR_NAME "ctrsv_thread_NLU_"
+#define CHAR_CNAME "ctrsv_thread_NLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA 1
+#define ASMNAME ctrsv_thread_NUN
+#define ASMFNAME ctrsv_thread_NUN_
+#define NAME ctrsv_thread_NUN_
+#define CNAME ctrsv_thread_NUN
+#define CHAR_NAME "ctrsv_thread_NUN_"
+#define CHAR_CNAME "ctrsv_thread_NUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
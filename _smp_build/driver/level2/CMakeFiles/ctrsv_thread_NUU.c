@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 1
+#define ASMNAME ctrsv_thread_NUU
+#define ASMFNAME ctrsv_thread_NUU_
+#define NAME ctrsv_thread_NUU_
+#define CNAME ctrsv_thread_NUU
+#define CHAR_NAME "ctrsv_thread_NUU_"
+#define CHAR_CNAME "ctrsv_thread_NUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
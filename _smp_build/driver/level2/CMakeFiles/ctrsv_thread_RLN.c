@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 3
+#define ASMNAME ctrsv_thread_RLN
+#define ASMFNAME ctrsv_thread_RLN_
+#define NAME ctrsv_thread_RLN_
+#define CNAME ctrsv_thread_RLN
+#define CHAR_NAME "ctrsv_thread_RLN_"
+#define CHAR_CNAME "ctrsv_thread_RLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctrsv_thread_RLU
+#define ASMFNAME ctrsv_thread_RLU_
+#define NAME ctrsv_thread_RLU_
+#define CNAME ctrsv_thread_RLU
+#define CHAR_NAME "ctrsv_thread_RLU_"
+#define CHAR_CNAME "ctrsv_thread_RLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
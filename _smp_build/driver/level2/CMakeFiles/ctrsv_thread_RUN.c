@@ -0,0 +1,9 @@
+#define TRANSA 3
+#define ASMNAME ctrsv_thread_RUN
+#define ASMFNAME ctrsv_thread_RUN_
+#define NAME ctrsv_thread_RUN_
+#define CNAME ctrsv_thread_RUN
+#define CHAR_NAME "ctrsv_thread_RUN_"
+#define CHAR_CNAME "ctrsv_thread_RUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 3
+#define ASMNAME ctrsv_thread_RUU
+#define ASMFNAME ctrsv_thread_RUU_
+#define NAME ctrsv_thread_RUU_
+#define CNAME ctrsv_thread_RUU
+#define CHAR_NAME "ctrsv_thread_RUU_"
+#define CHAR_CNAME "ctrsv_thread_RUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define LOWER
+#define TRANSA 2
+#define ASMNAME ctrsv_thread_TLN
+#define ASMFNAME ctrsv_thread_TLN_
+#define NAME ctrsv_thread_TLN_
+#define CNAME ctrsv_thread_TLN
+#define CHAR_NAME "ctrsv_thread_TLN_"
+#define CHAR_CNAME "ctrsv_thread_TLN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,11 @@
+#define LOWER
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctrsv_thread_TLU
+#define ASMFNAME ctrsv_thread_TLU_
+#define NAME ctrsv_thread_TLU_
+#define CNAME ctrsv_thread_TLU
+#define CHAR_NAME "ctrsv_thread_TLU_"
+#define CHAR_CNAME "ctrsv_thread_TLU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
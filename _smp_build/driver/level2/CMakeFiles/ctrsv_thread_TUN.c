@@ -0,0 +1,9 @@
+#define TRANSA 2
+#define ASMNAME ctrsv_thread_TUN
+#define ASMFNAME ctrsv_thread_TUN_
+#define NAME ctrsv_thread_TUN_
+#define CNAME ctrsv_thread_TUN
+#define CHAR_NAME "ctrsv_thread_TUN_"
+#define CHAR_CNAME "ctrsv_thread_TUN"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
@@ -0,0 +1,10 @@
+#define UNIT
+#define TRANSA 2
+#define ASMNAME ctrsv_thread_TUU
+#define ASMFNAME ctrsv_thread_TUU_
+#define NAME ctrsv_thread_TUU_
+#define CNAME ctrsv_thread_TUU
+#define CHAR_NAME "ctrsv_thread_TUU_"
+#define CHAR_CNAME "ctrsv_thread_TUU"
+#define COMPLEX
+#include "/root/repo/driver/level2/trsv_thread.c"
\ No newline at end of file
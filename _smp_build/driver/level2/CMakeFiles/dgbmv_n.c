@@ -0,0 +1,8 @@
+#define ASMNAME dgbmv_n
+#define ASMFNAME dgbmv_n_
+#define NAME dgbmv_n_
+#define CNAME dgbmv_n
+#define CHAR_NAME "dgbmv_n_"
+#define CHAR_CNAME "dgbmv_n"
+#define DOUBLE
+#include "/root/repo/driver/level2/gbmv_k.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME dgbmv_thread_n
+#define ASMFNAME dgbmv_thread_n_
+#define NAME dgbmv_thread_n_
+#define CNAME dgbmv_thread_n
+#define CHAR_NAME "dgbmv_thread_n_"
+#define CHAR_CNAME "dgbmv_thread_n"
+#define DOUBLE
+#include "/root/repo/driver/level2/gbmv_thread.c"
\ No newline at end of file
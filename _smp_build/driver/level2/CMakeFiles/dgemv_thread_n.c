@@ -0,0 +1,8 @@
+#define ASMNAME dgemv_thread_n
+#define ASMFNAME dgemv_thread_n_
+#define NAME dgemv_thread_n_
+#define CNAME dgemv_thread_n
+#define CHAR_NAME "dgemv_thread_n_"
+#define CHAR_CNAME "dgemv_thread_n"
+#define DOUBLE
+#include "/root/repo/driver/level2/gemv_thread.c"
\ No newline at end of file
@@ -0,0 +1,8 @@
+#define ASMNAME dgemvm_thread_n
+#define ASMFNAME dgemvm_thread_n_
+#define NAME dgemvm_thread_n_
+#define CNAME dgemvm_thread_n
+#define CHAR_NAME "dgemvm_thread_n_"
+#define CHAR_CNAME "dgemvm_thread_n"
+#define DOUBLE
+#include "/root/repo/driver/level2/gemvm_thread.c"
\ No newline at end of file
@@ -0,0 +1,9 @@
+#define TRANSA
+#define ASMNAME dgemvm_thread_t
+#define ASMFNAME dgemvm_thread_t_
+#define NAME dgemvm_thread_t_
+#define CNAME dgemvm_thread_t
+#define CHAR_NAME "dgemvm_thread_t_"
+#define CHAR_CNAME "dgemvm_thread_t"
+#define DOUBLE
+#include "/root/repo/driver/level2/gemvm_thread.c"
\ No newline at end of file
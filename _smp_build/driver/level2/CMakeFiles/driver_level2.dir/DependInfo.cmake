@@ -0,0 +1,786 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_thread_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_thread_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgbmv_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgbmv_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cgemv_thread_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cgemv_thread_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cger_thread_C.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_C.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_C.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cger_thread_D.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_D.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_D.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cger_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cger_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cger_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chbmv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chbmv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chemv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chemv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chemv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chemv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chemv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher2_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher2_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cher_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cher_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpmv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpmv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr2_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr2_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/chpr_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/chpr_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/cspr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/cspr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csymv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csymv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csymv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csymv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csymv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csymv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/csyr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/csyr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctbsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctbsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctpsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctpsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ctrsv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ctrsv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgbmv_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgbmv_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgbmv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgbmv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgbmv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgemv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgemv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgemvm_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemvm_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemvm_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dgemvm_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemvm_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dgemvm_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dger_thread.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dger_thread.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dger_thread.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dspr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dspr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsymv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsymv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsymv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsymv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsymv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsymv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2v_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2v_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2v_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr2v_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2v_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr2v_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dsyr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dsyr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtbsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtbsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtpsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtpsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/dtrsv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/dtrsv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sbgemv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sbgemv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sbgemv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sbgemv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sbgemv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sbgemv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgbmv_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgbmv_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgbmv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgbmv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgbmv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgemv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgemv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgemvm_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemvm_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemvm_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sgemvm_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemvm_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sgemvm_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sger_thread.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sger_thread.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sger_thread.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/sspr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/sspr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssymv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssymv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssymv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssymv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssymv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssymv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2v_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2v_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2v_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr2v_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2v_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr2v_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ssyr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ssyr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stbsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stbsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/stpsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/stpsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/strsv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/strsv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_thread_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_thread_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgbmv_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgbmv_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_c.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_c.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_c.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_d.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_d.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_d.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_n.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_n.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_n.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_o.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_o.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_o.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_r.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_r.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_r.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_s.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_s.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_s.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_t.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_t.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_t.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zgemv_thread_u.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_u.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zgemv_thread_u.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zger_thread_C.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_C.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_C.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zger_thread_D.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_D.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_D.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zger_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zger_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zger_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhbmv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhbmv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhemv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhemv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhemv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhemv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhemv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher2_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher2_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zher_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zher_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpmv_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpmv_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr2_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr2_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_thread_M.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_M.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_M.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zhpr_thread_V.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_V.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zhpr_thread_V.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsbmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsbmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsbmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsbmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsbmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspmv_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspmv_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspmv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspmv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspmv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zspr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zspr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsymv_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsymv_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsymv_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsymv_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsymv_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsymv_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr2_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr2_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr2_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr2_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr2_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr_thread_L.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_thread_L.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_thread_L.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/zsyr_thread_U.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_thread_U.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/zsyr_thread_U.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztbsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztbsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztpsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztpsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrmv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrmv_thread_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_TUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_CLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_CLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_CUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_CUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_CUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_NLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_NLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_NUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_NUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_NUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_RLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_RLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_RUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_RUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_RUU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_TLN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TLN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TLN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_TLU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TLU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TLU.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_TUN.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TUN.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TUN.c.o.d"
+  "/root/repo/_smp_build/driver/level2/CMakeFiles/ztrsv_thread_TUU.c" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TUU.c.o" "gcc" "driver/level2/CMakeFiles/driver_level2.dir/CMakeFiles/ztrsv_thread_TUU.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")